@@ -331,6 +331,350 @@ namespace SDOM
     }
 
 
+    bool Core_EventPool_Recycles(std::vector<std::string>& errors)
+    {
+        constexpr int kBurst = 64;
+        auto burst = []()
+        {
+            std::vector<std::unique_ptr<Event>> events;
+            events.reserve(kBurst);
+            for (int i = 0; i < kBurst; ++i)
+                events.push_back(std::make_unique<Event>(EventType::MouseMove));
+        };
+
+        burst();    // warm the pool
+        const Event::PoolStats before = Event::getPoolStats();
+        burst();
+        const Event::PoolStats after = Event::getPoolStats();
+
+        if (after.heapAllocations != before.heapAllocations) {
+            errors.push_back("Event pool hit the heap on a warm burst (" +
+                             std::to_string(after.heapAllocations - before.heapAllocations) + " allocations)");
+        }
+        if (after.poolReuses - before.poolReuses != static_cast<uint64_t>(kBurst)) {
+            errors.push_back("Event pool did not recycle every block in a warm burst");
+        }
+        if (after.live != before.live) {
+            errors.push_back("Event pool live count drifted across a burst");
+        }
+
+        return true;
+    }
+
+
+    bool Core_SDLEventBatch_Coalesces(std::vector<std::string>& errors)
+    {
+        std::vector<SDL_Event> batch;
+        auto motion = [](float x, float y) {
+            SDL_Event e{};
+            e.type = SDL_EVENT_MOUSE_MOTION;
+            e.motion.x = x; e.motion.y = y;
+            e.motion.xrel = 1.0f; e.motion.yrel = 2.0f;
+            return e;
+        };
+
+        // 100 motions, a button press, 100 motions, then 3 wheel ticks
+        for (int i = 0; i < 100; ++i) EventManager::batchSDL_Event(batch, motion(float(i), 0.0f));
+        SDL_Event down{};
+        down.type = SDL_EVENT_MOUSE_BUTTON_DOWN;
+        EventManager::batchSDL_Event(batch, down);
+        for (int i = 0; i < 100; ++i) EventManager::batchSDL_Event(batch, motion(float(200 + i), 5.0f));
+        for (int i = 0; i < 3; ++i)
+        {
+            SDL_Event wheel{};
+            wheel.type = SDL_EVENT_MOUSE_WHEEL;
+            wheel.wheel.y = 1.0f;
+            EventManager::batchSDL_Event(batch, wheel);
+        }
+
+        if (batch.size() != 4) {
+            errors.push_back("Expected 4 batched SDL events, got " + std::to_string(batch.size()));
+            return true;
+        }
+        if (batch[0].motion.x != 99.0f || batch[0].motion.xrel != 100.0f || batch[0].motion.yrel != 200.0f)
+            errors.push_back("Coalesced motion did not keep last position and summed deltas");
+        if (batch[1].type != SDL_EVENT_MOUSE_BUTTON_DOWN)
+            errors.push_back("Button press was reordered or merged");
+        if (batch[2].motion.x != 299.0f)
+            errors.push_back("Second motion run not coalesced to its last position");
+        if (batch[3].wheel.y != 3.0f)
+            errors.push_back("Wheel deltas not summed (got " + std::to_string(batch[3].wheel.y) + ")");
+
+        // Fidelity policy keeps every event
+        EventType::MouseMove.setBatchPolicy(EventType::BatchPolicy::Fidelity);
+        std::vector<SDL_Event> full;
+        for (int i = 0; i < 10; ++i) EventManager::batchSDL_Event(full, motion(float(i), 0.0f));
+        EventType::MouseMove.setBatchPolicy(EventType::BatchPolicy::Coalesce);
+        if (full.size() != 10)
+            errors.push_back("Fidelity policy dropped motion events");
+
+        return true;
+    }
+
+
+    bool Core_RenderCommands_MergeByState(std::vector<std::string>& errors)
+    {
+        SDL_Renderer* renderer = getRenderer();
+        if (!renderer) return true;
+        SDL_Texture* target = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
+                                                SDL_TEXTUREACCESS_TARGET, 256, 256);
+        if (!target) {
+            errors.push_back(std::string("Unable to create offscreen target: ") + SDL_GetError());
+            return true;
+        }
+
+        const SDL_Color red   = { 255, 0, 0, 255 };
+        const SDL_Color green = { 0, 255, 0, 255 };
+        RenderCommandBuffer buffer;
+
+        // Interleaved, non-overlapping: 16 commands fold into two fill calls
+        buffer.begin(renderer, target);
+        for (int i = 0; i < 8; ++i)
+        {
+            buffer.fillRect(SDL_FRect{ float(i * 20), 0.0f, 10.0f, 10.0f }, red);
+            buffer.fillRect(SDL_FRect{ float(i * 20), 20.0f, 10.0f, 10.0f }, green);
+        }
+        buffer.end();
+        RenderCommandBuffer::Stats s = buffer.getStatsLastFrame();
+        if (s.recorded != 16 || s.submitted != 2)
+            errors.push_back("Expected 16 commands in 2 submits, got " + std::to_string(s.recorded) +
+                             " in " + std::to_string(s.submitted));
+
+        // Overlapping: red, green on top, red on top again must stay three submits
+        buffer.begin(renderer, target);
+        buffer.fillRect(SDL_FRect{ 0.0f, 0.0f, 50.0f, 50.0f }, red);
+        buffer.fillRect(SDL_FRect{ 10.0f, 10.0f, 50.0f, 50.0f }, green);
+        buffer.fillRect(SDL_FRect{ 20.0f, 20.0f, 50.0f, 50.0f }, red);
+        buffer.end();
+        s = buffer.getStatsLastFrame();
+        if (s.submitted != 3 || s.reordered != 0)
+            errors.push_back("Overlapping draws were reordered across a different state");
+
+        buffer.reset();
+        SDL_DestroyTexture(target);
+        return true;
+    }
+
+
+    bool Core_DirtyRect_PartialRedraw(std::vector<std::string>& errors)
+    {
+        // 🔄 re-entrant: one step per frame so onRender() runs in between.
+        // An empty stage of its own keeps other objects' damage out of the counts.
+        static int step = 0;
+        static DisplayHandle previousRoot;
+        Core& core = getCore();
+        Factory& factory = core.getFactory();
+        switch (step++)
+        {
+            case 0:
+            {
+                Stage::InitStruct init;
+                init.name = "dirty_rect_stage";
+                DisplayHandle stage = factory.createDisplayObject(Stage::TypeName, init);
+                if (!stage.isValid())
+                {
+                    errors.push_back("Unable to create dirty_rect_stage");
+                    return true;
+                }
+                previousRoot = core.getRootNode();
+                core.setRootNode(stage);
+                core.setDirtyRectRedraw(true);
+                core.setDirtyRectThreshold(0.5f);
+                return false;
+            }
+            case 1:
+            case 2:
+                return false;   // let the initial full redraw happen
+            case 3:
+                core.addDamage(SDL_FRect{ 0.0f, 0.0f, 4.0f, 4.0f });
+                return false;
+            default:
+                break;
+        }
+
+        // The one 4x4 rect is far below the threshold: a single clipped pass
+        Core::RedrawStats stats = core.getRedrawStatsLastFrame();
+        if (stats.fullRedraw)
+            errors.push_back("A 4x4 damage rect caused a full redraw (damaged fraction " +
+                             std::to_string(stats.damagedFraction) + ")");
+        if (stats.damageRects != 1)
+            errors.push_back("Partial redraw reported " + std::to_string(stats.damageRects) +
+                             " damaged rects (expected 1)");
+        if (stats.damagedFraction > core.getDirtyRectThreshold())
+            errors.push_back("Partial redraw used above the full-redraw threshold");
+
+        core.setDirtyRectRedraw(false);
+        core.setRootNode(previousRoot);
+        previousRoot = DisplayHandle();
+        factory.destroyDisplayObject("dirty_rect_stage");
+        return true;
+    }
+
+
+    bool Core_IdleMode_WakesOnWork(std::vector<std::string>& errors)
+    {
+        Core& core = getCore();
+        const bool wasIdle = core.isIdleMode();
+
+        core.setIdleMode(true);
+        if (core.wouldIdle())
+            errors.push_back("Enabling idle mode should request one more frame");
+
+        core.setIdleMode(false);
+        if (core.wouldIdle())
+            errors.push_back("wouldIdle() must be false while idle mode is off");
+
+        // Posted work must keep the loop awake until it is drained
+        core.setIdleMode(true);
+        EventManager& em = core.getEventManager();
+        em.postEvent(std::make_unique<Event>(EventType::User, core.getStageHandle()));
+        if (!em.hasPendingEvents())
+            errors.push_back("A posted event was not reported as pending");
+        em.DispatchQueuedEvents();
+
+        core.setIdleMode(wasIdle);
+        return true;
+    }
+
+
+    bool Core_TexturePool_ReusesBuckets(std::vector<std::string>& errors)
+    {
+        if (TexturePool::bucketSize(1) != 32 || TexturePool::bucketSize(33) != 64 ||
+            TexturePool::bucketSize(1000) != 1024)
+            errors.push_back("TexturePool::bucketSize() rounding is off");
+
+        SDL_Renderer* renderer = getCore().getRenderer();
+        if (!renderer) return true;
+
+        // A private pool keeps the counts independent of live widgets;
+        // the atlas is off so these small sizes get textures of their own
+        TexturePool pool;
+        pool.setAtlasEnabled(false);
+        const SDL_PixelFormat fmt = SDL_PIXELFORMAT_RGBA8888;
+        TexturePool::Lease a;
+        if (!pool.lease(a, renderer, 100, 40, fmt) || !a)
+        {
+            errors.push_back("TexturePool::lease() failed for 100x40");
+            return true;
+        }
+        SDL_Texture* first = a.texture;
+
+        // Growing within the bucket keeps the texture; the lease tracks the size
+        pool.lease(a, renderer, 110, 45, fmt);
+        if (a.texture != first || a.width != 110 || a.height != 45)
+            errors.push_back("Resize within a bucket should keep the leased texture");
+
+        // A released texture serves the next request for the same bucket
+        pool.release(a);
+        if (a || pool.getStats().pooledBytes == 0)
+            errors.push_back("Released texture was not returned to the pool");
+        TexturePool::Lease b;
+        pool.lease(b, renderer, 120, 50, fmt);
+        TexturePool::Stats st = pool.getStats();
+        if (b.texture != first || st.misses != 1 || st.textures != 1)
+            errors.push_back("Same-bucket lease should reuse the pooled texture");
+        if (st.leasedBytes != std::size_t(128) * 64 * SDL_BYTESPERPIXEL(fmt) || st.pooledBytes != 0)
+            errors.push_back("TexturePool byte accounting is off");
+
+        // Stale leases (after clear) must not disturb the pool
+        pool.clear();
+        pool.release(b);
+        if (pool.getStats().textures != 0)
+            errors.push_back("Releasing a stale lease should be a no-op");
+        return true;
+    } // END: Core_TexturePool_ReusesBuckets()
+
+    bool Core_TexturePool_AtlasPacks(std::vector<std::string>& errors)
+    {
+        SDL_Renderer* renderer = getCore().getRenderer();
+        if (!renderer) return true;
+
+        TexturePool pool;
+        const SDL_PixelFormat fmt = SDL_PIXELFORMAT_RGBA8888;
+
+        // Small leases share one page at distinct, non-overlapping areas
+        std::vector<TexturePool::Lease> leases(64);
+        for (auto& l : leases)
+            pool.lease(l, renderer, 60, 20, fmt);
+        TexturePool::Stats st = pool.getStats();
+        if (st.atlasPages != 1 || st.atlasSlots != leases.size() || st.textures != 0)
+            errors.push_back("64 small leases should pack into one atlas page");
+        for (std::size_t i = 1; i < leases.size(); ++i)
+        {
+            if (leases[i].texture != leases[0].texture)
+                errors.push_back("Atlas leases landed on different pages");
+            SDL_FRect a = leases[i - 1].srcRect(), b = leases[i].srcRect();
+            if (a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h)
+                errors.push_back("Atlas slots overlap");
+        }
+
+        // A freed slot is handed to the next lease of the same bucket
+        SDL_FRect freed = leases[10].srcRect();
+        pool.release(leases[10]);
+        pool.lease(leases[10], renderer, 50, 30, fmt);
+        if (leases[10].x != int(freed.x) || leases[10].y != int(freed.y))
+            errors.push_back("Freed atlas slot was not reused");
+
+        // Large leases still get a texture of their own
+        TexturePool::Lease big;
+        pool.lease(big, renderer, 400, 300, fmt);
+        if (!big || big.texture == leases[0].texture || big.x != 0 || big.y != 0)
+            errors.push_back("Oversized lease should not come from the atlas");
+        pool.release(big);
+
+        // Thin a second page out until it is sparse; trim() moves its
+        // survivors into the first page and the holders follow via sync()
+        std::vector<TexturePool::Lease> extra(400);
+        for (auto& l : extra)
+            pool.lease(l, renderer, 60, 20, fmt);
+        SDL_Texture* second = extra.back().texture;
+        for (auto& l : extra)
+            if (l.texture == second && &l != &extra.back()) pool.release(l);
+        for (std::size_t i = 0; i < 200; ++i) pool.release(extra[i]);
+        pool.trim();
+        TexturePool::Lease moved = extra.back();
+        if (!pool.sync(moved) || moved.texture == second)
+            errors.push_back("Sparse atlas page was not compacted");
+
+        // After clear() every lease is stale and must be repainted
+        pool.clear();
+        if (pool.sync(moved) || moved)
+            errors.push_back("sync() should report leases lost by clear()");
+        return true;
+    } // END: Core_TexturePool_AtlasPacks()
+
+
+    bool Core_Headless_FrameBuffer(std::vector<std::string>& errors)
+    {
+        using nlohmann::json;
+        Core& core = getCore();
+        const bool headless = core.isHeadless();
+
+        // The video driver is fixed once SDL is up, so a later toggle is refused
+        json doc = json::object();
+        doc["headless"] = !headless;
+        core.configureFromJson(doc);
+        if (core.getConfig().headless != headless || core.isHeadless() != headless)
+            errors.push_back("'headless' changed after SDL video was initialized");
+
+        Core::FrameBuffer fb = core.getFrameBuffer();
+        if (!headless)
+        {
+            if (fb)
+                errors.push_back("getFrameBuffer() should be empty when not headless");
+            return true;
+        }
+
+        float texW = 0.0f, texH = 0.0f;
+        SDL_GetTextureSize(core.getTexture(), &texW, &texH);
+        if (!fb || fb.width != static_cast<int>(texW) || fb.height != static_cast<int>(texH))
+            errors.push_back("Headless frame buffer should match the stage texture size");
+        else if (fb.pitch < fb.width * SDL_BYTESPERPIXEL(fb.format))
+            errors.push_back("Headless frame buffer pitch is too small");
+        return true;
+    } // END: Core_Headless_FrameBuffer()
+
+
     bool Core_LUA_Tests(std::vector<std::string>& errors)
     {
         return UnitTests::getInstance().run_lua_tests(errors, "src/Core_UnitTests.lua");
@@ -353,6 +697,14 @@ namespace SDOM
             ut.add_test(objName, "CAPI: asset variant create/get/destroy", Core_Variant_Asset_CreateGetDestroy);
             ut.add_test(objName, "CAPI: variant focus/hover parity", Core_Variant_FocusHover);
             ut.add_test(objName, "Config: rendererVSync JSON parsing", Core_RendererVSync_ConfigureFromJson);
+            ut.add_test(objName, "Event pool recycles storage", Core_EventPool_Recycles);
+            ut.add_test(objName, "Batched SDL events coalesce per policy", Core_SDLEventBatch_Coalesces);
+            ut.add_test(objName, "Render commands merge by state", Core_RenderCommands_MergeByState);
+            ut.add_test(objName, "Dirty-rect redraw repaints only damage", Core_DirtyRect_PartialRedraw);
+            ut.add_test(objName, "Idle mode wakes for pending work", Core_IdleMode_WakesOnWork);
+            ut.add_test(objName, "Texture pool reuses size buckets", Core_TexturePool_ReusesBuckets);
+            ut.add_test(objName, "Texture pool packs small leases into atlas pages", Core_TexturePool_AtlasPacks);
+            ut.add_test(objName, "Headless frame buffer view", Core_Headless_FrameBuffer);
 
 
 
@@ -10,11 +10,14 @@
 #include <SDOM/SDOM_SubjectBinding.hpp>
 #include <SDOM/CAPI/SDOM_CAPI_Core.h>
 #include <SDOM/CAPI/SDOM_CAPI_Event.h>
+#include <SDOM/CAPI/SDOM_CAPI_EventQueue.h>
+#include <SDOM/SDOM_EventManager.hpp>
 
 #include <json.hpp>
 
 #include <algorithm>
 #include <cstring>
+#include <thread>
 
 namespace SDOM
 {
@@ -327,6 +330,86 @@ namespace SDOM
         return true;
     }
 
+    bool Event_CAPI_typed_input_payload(std::vector<std::string>& errors)
+    {
+        SDOM::Event ev(SDOM::EventType::MouseMove);
+        ev.setMouseX(12.5f).setMouseY(-3.0f).setWheelY(1.0f).setButton(3).setClickCount(2);
+        ev.setKeycode(SDLK_A).setKeymod(SDL_KMOD_SHIFT).setAsciiCode('A');
+
+        // Built-in input fields must not spill into the custom JSON payload
+        if (ev.getPayloadString() != "{}") {
+            errors.push_back("Input accessors wrote into the JSON payload: " + ev.getPayloadString());
+        }
+
+        SDOM::Event copy = ev;
+        const auto in = copy.getInputPayload();
+        if (in.mouseX != 12.5f || in.mouseY != -3.0f || in.wheelY != 1.0f) {
+            errors.push_back("Copied event lost mouse/wheel input fields");
+        }
+        if (in.button != 3 || in.clickCount != 2) {
+            errors.push_back("Copied event lost button/click input fields");
+        }
+        if (copy.getKeycode() != SDLK_A || copy.getKeymod() != SDL_KMOD_SHIFT || copy.getAsciiCode() != 'A') {
+            errors.push_back("Copied event lost keyboard input fields");
+        }
+
+        // Custom data still goes through the JSON payload
+        copy.setPayloadValue("custom", 7);
+        if (copy.getPayloadValue<int>("custom") != 7 || ev.payloadKeyExists("custom")) {
+            errors.push_back("Custom JSON payload not stored independently per event");
+        }
+        return true;
+    }
+
+    bool Event_CAPI_cross_thread_post(std::vector<std::string>& errors)
+    {
+        constexpr int kThreads = 4;
+        constexpr int kPerThread = 200;
+        static SDOM::EventType probe("PostQueueProbe", "Test");
+
+        SDOM::DisplayHandle stage = SDOM::getCore().getRootNode();
+        if (!stage) return true;
+        SDOM::EventManager& em = SDOM::getCore().getEventManager();
+
+        int hits = 0;
+        auto listener = [&hits](SDOM::Event&) { ++hits; };
+        stage->addEventListener(probe, listener);
+
+        const SDOM::EventManager::PostQueueStats before = em.getPostQueueStats();
+        const auto typeId = static_cast<SDOM_EventType>(probe.getOrAssignId());
+        std::vector<std::thread> producers;
+        for (int t = 0; t < kThreads; ++t)
+        {
+            producers.emplace_back([typeId]() {
+                for (int i = 0; i < kPerThread; ++i)
+                    SDOM_PostEvent(typeId, 0, nullptr);
+            });
+        }
+        for (auto& th : producers) th.join();
+
+        em.DispatchQueuedEvents();
+
+        SDOM_EventQueueStats after{};
+        if (!SDOM_GetEventQueueStats(&after)) {
+            errors.push_back("SDOM_GetEventQueueStats failed");
+        } else {
+            const uint64_t accepted = after.posted - before.posted;
+            const uint64_t rejected = after.rejected - before.rejected;
+            if (accepted + rejected != static_cast<uint64_t>(kThreads * kPerThread)) {
+                errors.push_back("Posted + rejected does not account for every post");
+            }
+            if (after.drained - before.drained != accepted) {
+                errors.push_back("Not every accepted post was drained");
+            }
+            if (hits != static_cast<int>(accepted)) {
+                errors.push_back("Delivered " + std::to_string(hits) + " of " + std::to_string(accepted) + " posted events");
+            }
+        }
+
+        stage->removeEventListener(probe, listener);
+        return true;
+    }
+
 
 
 
@@ -354,6 +437,8 @@ namespace SDOM
             ut.add_test(objName, "Payload missing key -> null Variant + error", Event_CAPI_payload_missing_key_returns_null);
             ut.add_test(objName, "Event Variant roundtrip", Event_CAPI_variant_roundtrip);
             ut.add_test(objName, "Event Variant wrong tag", Event_CAPI_variant_wrong_tag);
+            ut.add_test(objName, "Typed input payload", Event_CAPI_typed_input_payload);
+            ut.add_test(objName, "Cross-thread event posting", Event_CAPI_cross_thread_post);
 
             // ut.add_test(objName, "Lua: src/Event_CAPI_UnitTests.lua", Event_CAPI_LUA_Tests, false);
 
@@ -12,6 +12,7 @@
 #include "Box.hpp"
 #include <thread>
 #include <chrono>
+#include <unordered_set>
 
 namespace SDOM
 {
@@ -52,6 +53,1153 @@ namespace SDOM
     } // END: IDisplayObject_test0(std::vector<std::string>& errors)
 
 
+    // ============================================================================
+    //  Test 1: World Bounds Cache (20-deep chain)
+    // ----------------------------------------------------------------------------
+    //  Builds a 20-deep chain of Boxes and verifies that world edges stay correct
+    //  when an ancestor moves, that one read of the deepest node leaves the whole
+    //  chain cached, and that moving a node invalidates only its own subtree.
+    //  With BENCHMARK_TEST_OUTPUT it also prints root vs. leaf read cost.
+    // ============================================================================
+    bool IDisplayObject_test1(std::vector<std::string>& errors)
+    {
+        constexpr int kDepth = 20;
+        Factory& factory = getFactory();
+
+        std::vector<DisplayHandle> chain;
+        chain.reserve(kDepth);
+        for (int i = 0; i < kDepth; ++i)
+        {
+            Box::InitStruct init;
+            init.name = "wb_chain_" + std::to_string(i);
+            init.x = static_cast<float>(i * 2);
+            init.y = static_cast<float>(i * 3);
+            init.width = static_cast<float>(400 - i * 4);
+            init.height = static_cast<float>(300 - i * 4);
+            DisplayHandle h = factory.createDisplayObject("Box", init);
+            if (!h) 
+            {
+                errors.push_back("Failed to create " + init.name);
+                for (auto& c : chain) factory.destroyDisplayObject(c.getName());
+                return true;
+            }
+            if (!chain.empty()) chain.back()->addChild(h);
+            chain.push_back(h);
+        }
+
+        IDisplayObject* root = chain.front().get();
+        IDisplayObject* leaf = chain.back().get();
+
+        // addChild() preserves world position, so the leaf stays where it was created
+        if (leaf->getX() != (kDepth - 1) * 2 || leaf->getY() != (kDepth - 1) * 3)
+            errors.push_back("Leaf world position incorrect before move");
+
+        // Moving the root must invalidate every cached descendant
+        root->setX(root->getX() + 5);
+        if (leaf->getX() != (kDepth - 1) * 2 + 5)
+            errors.push_back("Leaf world X did not follow root move (got " + std::to_string(leaf->getX()) + ")");
+        if (leaf->getWidth() != 400 - (kDepth - 1) * 4)
+            errors.push_back("Leaf width changed after root move");
+
+        // The leaf read above resolved every ancestor on the way
+        for (int i = 0; i < kDepth; ++i)
+        {
+            if (chain[i]->isWorldBoundsDirty())
+            {
+                errors.push_back("Chain node " + std::to_string(i) + " still dirty after reading the leaf");
+                break;
+            }
+        }
+
+        // Moving a middle node leaves its ancestors cached and its descendants stale
+        const int mid = kDepth / 2;
+        chain[mid]->setX(chain[mid]->getX() + 1);
+        for (int i = 0; i < kDepth; ++i)
+        {
+            if (i == mid) continue;
+            if (chain[i]->isWorldBoundsDirty() != (i > mid))
+                errors.push_back("Chain node " + std::to_string(i) + (i > mid ? " not invalidated" : " invalidated")
+                                 + " by moving node " + std::to_string(mid));
+        }
+        if (leaf->getX() != (kDepth - 1) * 2 + 6)
+            errors.push_back("Leaf world X did not follow middle move (got " + std::to_string(leaf->getX()) + ")");
+
+        // Opt-in timing: warm-cache getX()/getWidth() on root vs. leaf (never asserted)
+        if constexpr (BENCHMARK_TEST_OUTPUT)
+        {
+            constexpr int kIterations = 100000;
+            auto time_calls = [&](IDisplayObject* obj) -> double
+            {
+                volatile int sink = 0;
+                auto start = std::chrono::steady_clock::now();
+                for (int i = 0; i < kIterations; ++i)
+                    sink = sink + obj->getX() + obj->getWidth();
+                auto end = std::chrono::steady_clock::now();
+                (void)sink;
+                return std::chrono::duration<double, std::nano>(end - start).count() / kIterations;
+            };
+            double rootNs = time_calls(root);
+            double leafNs = time_calls(leaf);
+            std::cout << "  World bounds cache: root " << rootNs << " ns/call, depth-" << kDepth
+                      << " leaf " << leafNs << " ns/call" << std::endl;
+        }
+
+        for (auto it = chain.rbegin(); it != chain.rend(); ++it)
+            factory.destroyDisplayObject(it->getName());
+
+        return true; // ✅ finished this frame
+    } // END: IDisplayObject_test1(std::vector<std::string>& errors)
+
+
+    // ============================================================================
+    //  Test 2: Hit-Test Index Parity
+    // ----------------------------------------------------------------------------
+    //  Samples a grid of points over the active stage and checks that the spatial
+    //  hit-test index picks the same object as the recursive tree walk.
+    // ============================================================================
+    bool IDisplayObject_test2(std::vector<std::string>& errors)
+    {
+        EventManager& em = getCore().getEventManager();
+        DisplayHandle stage = getCore().getRootNode();
+        if (!stage) return true; // nothing to compare against
+
+        const bool wasEnabled = em.isHitTestIndexEnabled();
+        const int w = stage->getWidth();
+        const int h = stage->getHeight();
+        const int step = 7;
+        struct Sample { int x; int y; bool clickableOnly; DisplayHandle walked; };
+        std::vector<Sample> samples;
+
+        em.setHitTestIndexEnabled(false);
+        for (int y = stage->getY(); y < stage->getY() + h; y += step)
+            for (int x = stage->getX(); x < stage->getX() + w; x += step)
+                for (bool clickableOnly : { true, false })
+                    samples.push_back({ x, y, clickableOnly, em.findTopObjectAt(stage, float(x), float(y), DisplayHandle(), clickableOnly) });
+
+        em.setHitTestIndexEnabled(true);
+        int mismatches = 0;
+        for (const auto& sample : samples)
+        {
+            DisplayHandle indexed = em.findTopObjectAt(stage, float(sample.x), float(sample.y), DisplayHandle(), sample.clickableOnly);
+            if (sample.walked != indexed && ++mismatches <= 5)
+            {
+                errors.push_back("Hit-test mismatch at (" + std::to_string(sample.x) + "," + std::to_string(sample.y) + 
+                                 "): walk='" + sample.walked.getName() + "' index='" + indexed.getName() + "'");
+            }
+        }
+        em.setHitTestIndexEnabled(wasEnabled);
+        return true; // ✅ finished this frame
+    } // END: IDisplayObject_test2(std::vector<std::string>& errors)
+
+
+    // ============================================================================
+    //  Test 3: Listener Subscription Index
+    // ----------------------------------------------------------------------------
+    //  Adding, removing, and destroying listeners must keep the EventManager's
+    //  per-EventType subscriber index in sync, and global dispatch must reach
+    //  exactly the subscribers indexed when it started, even when a listener
+    //  destroys them and new objects take over their addresses.
+    // ============================================================================
+    bool IDisplayObject_test3(std::vector<std::string>& errors)
+    {
+        static EventType probe("ListenerIndexProbe", "Test");
+        EventManager& em = getCore().getEventManager();
+        Factory& factory = getFactory();
+
+        if (em.hasListeners(probe))
+            errors.push_back("Probe event type has listeners before any were added");
+
+        Box::InitStruct init;
+        init.name = "listener_index_box";
+        init.width = 10.0f;
+        init.height = 10.0f;
+        DisplayHandle box = factory.createDisplayObject("Box", init);
+        if (!box) 
+        {
+            errors.push_back("Failed to create " + init.name);
+            return true;
+        }
+
+        int hits = 0;
+        auto listener = [&hits](Event&) { ++hits; };
+        box->addEventListener(probe, listener);
+        if (!em.hasListeners(probe))
+            errors.push_back("hasListeners() false after addEventListener()");
+
+        em.dispatchEventToAllEventListenersGlobally(std::make_unique<Event>(probe, box));
+        if (hits != 1)
+            errors.push_back("Global dispatch reached " + std::to_string(hits) + " listeners (expected 1)");
+
+        box->removeEventListener(probe, listener);
+        if (em.hasListeners(probe))
+            errors.push_back("hasListeners() true after removeEventListener()");
+
+        // Destroying a subscribed object must drop its index entries
+        box->addEventListener(probe, listener);
+        factory.destroyDisplayObject(init.name);
+        if (em.hasListeners(probe))
+            errors.push_back("hasListeners() true after subscriber was destroyed");
+
+        // Subscribers destroyed mid-dispatch and replaced (the pool hands their
+        // addresses to the replacements) must not reach the replacements' listeners
+        constexpr int kVictims = 8;
+        int replacementHits = 0;
+        std::vector<std::string> replacements;
+        for (int i = 0; i < kVictims; ++i)
+        {
+            init.name = "listener_victim_" + std::to_string(i);
+            DisplayHandle victim = factory.createDisplayObject("Box", init);
+            if (victim) victim->addEventListener(probe, [](Event&) {});
+        }
+        init.name = "listener_reaper";
+        DisplayHandle reaper = factory.createDisplayObject("Box", init);
+        if (!reaper)
+        {
+            errors.push_back("Failed to create " + init.name);
+            return true;
+        }
+        reaper->addEventListener(probe, [&](Event&)
+        {
+            if (!replacements.empty()) return;
+            Box::InitStruct next = init;
+            for (int i = 0; i < kVictims; ++i)
+            {
+                factory.destroyDisplayObject("listener_victim_" + std::to_string(i));
+                next.name = "listener_replacement_" + std::to_string(i);
+                replacements.push_back(next.name);
+                DisplayHandle fresh = factory.createDisplayObject("Box", next);
+                if (fresh) fresh->addEventListener(probe, [&replacementHits](Event&) { ++replacementHits; });
+            }
+        });
+        em.dispatchEventToAllEventListenersGlobally(std::make_unique<Event>(probe, reaper));
+        if (replacementHits != 0)
+            errors.push_back("Global dispatch reached " + std::to_string(replacementHits)
+                             + " listeners added to replacement objects during the dispatch");
+
+        for (const auto& name : replacements) factory.destroyDisplayObject(name);
+        for (int i = 0; i < kVictims; ++i) factory.destroyDisplayObject("listener_victim_" + std::to_string(i));
+        factory.destroyDisplayObject("listener_reaper");
+        if (em.hasListeners(probe))
+            errors.push_back("hasListeners() true after every subscriber was destroyed");
+
+        return true; // ✅ finished this frame
+    } // END: IDisplayObject_test3(std::vector<std::string>& errors)
+
+
+    // ============================================================================
+    //  Test 4: Listener Dispatch by EventType Id
+    // ----------------------------------------------------------------------------
+    //  An object listening to several event types gets one listener call per
+    //  triggered event, only for that event's type, and none for a type it does
+    //  not listen to. Every type involved has a distinct id. With
+    //  BENCHMARK_TEST_OUTPUT it also prints id-table vs. name-map dispatch cost.
+    // ============================================================================
+    bool IDisplayObject_test4(std::vector<std::string>& errors)
+    {
+        EventType* types[] = {
+            &EventType::MouseButtonDown, &EventType::MouseButtonUp, &EventType::MouseMove,
+            &EventType::MouseEnter, &EventType::MouseLeave, &EventType::KeyDown,
+            &EventType::KeyUp, &EventType::ValueChanged
+        };
+        constexpr int kTypes = static_cast<int>(sizeof(types) / sizeof(types[0]));
+
+        Box::InitStruct init;
+        init.name = "listener_dispatch_box";
+        init.width = 10.0f;
+        init.height = 10.0f;
+        DisplayHandle box = getFactory().createDisplayObject("Box", init);
+        if (!box) 
+        {
+            errors.push_back("Failed to create " + init.name);
+            return true;
+        }
+
+        // One counter per type; each listener bumps only its own
+        std::vector<int> calls(kTypes, 0);
+        for (int t = 0; t < kTypes; ++t)
+            box->addEventListener(*types[t], [&calls, t](Event&) { ++calls[t]; });
+
+        // Subscribing assigns the ids the listener table is keyed by
+        std::unordered_set<EventType::IdType> ids;
+        for (EventType* t : types)
+        {
+            if (t->getId() == 0 || !ids.insert(t->getId()).second)
+                errors.push_back("EventType '" + t->getName() + "' has no id or shares one");
+        }
+
+        for (int round = 0; round < 3; ++round)
+        {
+            for (int t = 0; t < kTypes; ++t)
+            {
+                Event ev(*types[t], box);
+                box->triggerEventListeners(ev, false);
+            }
+        }
+        for (int t = 0; t < kTypes; ++t)
+        {
+            if (calls[t] != 3)
+                errors.push_back("Listener for '" + types[t]->getName() + "' ran " + std::to_string(calls[t]) + " times (expected 3)");
+        }
+
+        // A type with no listener reaches none of them
+        Event other(EventType::MouseWheel, box);
+        box->triggerEventListeners(other, false);
+        for (int t = 0; t < kTypes; ++t)
+        {
+            if (calls[t] != 3)
+            {
+                errors.push_back("MouseWheel dispatch reached the '" + types[t]->getName() + "' listener");
+                break;
+            }
+        }
+        if (box->hasEventListener(EventType::MouseWheel, false))
+            errors.push_back("hasEventListener(MouseWheel) true with no MouseWheel listener");
+
+        // Opt-in timing: id-keyed table vs. a map keyed by the type name (never asserted)
+        if constexpr (BENCHMARK_TEST_OUTPUT)
+        {
+            constexpr int kIterations = 200000;
+            volatile int sink = 0;
+            auto listener = [&sink](Event&) { sink = sink + 1; };
+            std::unordered_map<std::string, std::vector<std::function<void(Event&)>>> reference;
+            for (int t = 0; t < kTypes; ++t)
+                reference[types[t]->getName()].push_back(listener);
+
+            std::vector<Event> events;
+            for (EventType* t : types)
+                events.emplace_back(*t, box);
+
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < kIterations; ++i)
+                box->triggerEventListeners(events[i % kTypes], false);
+            auto mid = std::chrono::steady_clock::now();
+            for (int i = 0; i < kIterations; ++i)
+            {
+                Event& ev = events[i % kTypes];
+                auto it = reference.find(ev.getType().getName());
+                if (it != reference.end())
+                    for (const auto& fn : it->second) fn(ev);
+            }
+            auto end = std::chrono::steady_clock::now();
+
+            double tableNs = std::chrono::duration<double, std::nano>(mid - start).count() / kIterations;
+            double nameNs = std::chrono::duration<double, std::nano>(end - mid).count() / kIterations;
+            std::cout << "  Listener dispatch: id table " << tableNs << " ns/event, name-hashed map "
+                      << nameNs << " ns/event" << std::endl;
+        }
+
+        getFactory().destroyDisplayObject(init.name);
+        return true; // ✅ finished this frame
+    } // END: IDisplayObject_test4(std::vector<std::string>& errors)
+
+
+    // ============================================================================
+    //  Test 5: Subtree Bitmap Cache
+    // ----------------------------------------------------------------------------
+    //  A cacheAsBitmap container on the stage is rendered into its cache once,
+    //  blitted unchanged while its subtree is quiet, and re-rendered after a
+    //  descendant becomes dirty. Re-entrant: one step per frame.
+    // ============================================================================
+    bool IDisplayObject_test5(std::vector<std::string>& errors)
+    {
+        static int step = 0;
+        static DisplayHandle panel;
+        static DisplayHandle child;
+        Factory& factory = getFactory();
+        Core& core = getCore();
+
+        switch (step++)
+        {
+            case 0:
+            {
+                Box::InitStruct init;
+                init.name = "cache_bitmap_panel";
+                init.x = 8.0f;  init.y = 8.0f;
+                init.width = 64.0f;  init.height = 48.0f;
+                panel = factory.createDisplayObject("Box", init);
+                init.name = "cache_bitmap_child";
+                init.x = 16.0f;  init.y = 16.0f;
+                init.width = 16.0f;  init.height = 16.0f;
+                child = factory.createDisplayObject("Box", init);
+                if (!panel || !child || !core.getRootNodePtr())
+                {
+                    errors.push_back("Failed to create the cached subtree");
+                    return true;
+                }
+                panel->addChild(child);
+                panel->setCacheAsBitmap(true);
+                core.getRootNodePtr()->addChild(panel);
+                return false;
+            }
+            case 1:
+            case 2:
+                return false;   // build the cache, then render one quiet frame
+            case 3:
+            {
+                Core::RedrawStats stats = core.getRedrawStatsLastFrame();
+                if (stats.cachedSubtrees < 1)
+                    errors.push_back("cacheAsBitmap subtree was not drawn from its cache");
+                if (stats.cacheRebuilds != 0)
+                    errors.push_back("Quiet cacheAsBitmap subtree was re-rendered");
+                child->setDirty(true);
+                return false;
+            }
+            default:
+                break;
+        }
+
+        Core::RedrawStats stats = core.getRedrawStatsLastFrame();
+        if (stats.cacheRebuilds < 1)
+            errors.push_back("Dirty descendant did not refresh the subtree cache");
+
+        core.getRootNodePtr()->removeChild(panel);
+        factory.destroyDisplayObject(child.getName());
+        factory.destroyDisplayObject(panel.getName());
+        return true; // ✅ finished
+    } // END: IDisplayObject_test5(std::vector<std::string>& errors)
+
+
+    bool IDisplayObject_test6(std::vector<std::string>& errors)
+    {
+        static int step = 0;
+        static DisplayHandle panel;
+        static DisplayHandle clipped;
+        static DisplayHandle offstage;
+        Factory& factory = getFactory();
+        Core& core = getCore();
+
+        switch (step++)
+        {
+            case 0:
+            {
+                Box::InitStruct init;
+                init.name = "clip_children_panel";
+                init.x = 8.0f;  init.y = 8.0f;
+                init.width = 64.0f;  init.height = 48.0f;
+                panel = factory.createDisplayObject("Box", init);
+                init.name = "clip_children_scrolled_away";
+                init.x = 300.0f;  init.y = 8.0f;
+                init.width = 16.0f;  init.height = 16.0f;
+                clipped = factory.createDisplayObject("Box", init);
+                init.name = "clip_children_offstage";
+                init.x = -5000.0f;  init.y = -5000.0f;
+                offstage = factory.createDisplayObject("Box", init);
+                if (!panel || !clipped || !offstage || !core.getRootNodePtr())
+                {
+                    errors.push_back("Failed to create the clipping subtree");
+                    return true;
+                }
+                panel->addChild(clipped);
+                panel->setClipChildren(true);
+                core.getRootNodePtr()->addChild(panel);
+                core.getRootNodePtr()->addChild(offstage);
+                return false;
+            }
+            case 1:
+                return false;   // render one frame with the new nodes
+            default:
+                break;
+        }
+
+        Core::RedrawStats stats = core.getRedrawStatsLastFrame();
+        if (stats.nodesCulled < 2)
+            errors.push_back("Clipped and off-stage nodes were not culled (culled=" +
+                             std::to_string(stats.nodesCulled) + ")");
+        if (stats.nodesVisited < stats.nodesDrawn)
+            errors.push_back("Fewer nodes visited than drawn");
+
+        core.getRootNodePtr()->removeChild(panel);
+        core.getRootNodePtr()->removeChild(offstage);
+        factory.destroyDisplayObject(clipped.getName());
+        factory.destroyDisplayObject(panel.getName());
+        factory.destroyDisplayObject(offstage.getName());
+        return true; // ✅ finished
+    } // END: IDisplayObject_test6(std::vector<std::string>& errors)
+
+
+    // ============================================================================
+    //  Test 7: Incremental Orphan Tracking
+    // ----------------------------------------------------------------------------
+    //  Parent changes keep the Factory's orphan count current without a registry
+    //  scan, retention policy changes reschedule pending orphans, and a zero GC
+    //  budget still destroys one due orphan per pass.
+    // ============================================================================
+    bool IDisplayObject_test7(std::vector<std::string>& errors)
+    {
+        Factory& factory = getFactory();
+        IDisplayObject* root = getCore().getRootNodePtr();
+        if (!root)
+        {
+            errors.push_back("No root node");
+            return true;
+        }
+
+        Box::InitStruct init;
+        init.name = "orphan_tracking_box";
+        init.width = 10.0f;
+        init.height = 10.0f;
+        const int base = factory.countOrphanedDisplayObjects();
+        DisplayHandle box = factory.createDisplayObject("Box", init);
+        if (!box)
+        {
+            errors.push_back("Failed to create " + init.name);
+            return true;
+        }
+        if (factory.countOrphanedDisplayObjects() != base + 1)
+            errors.push_back("A new parentless object was not counted as an orphan");
+        root->addChild(box);
+        if (factory.countOrphanedDisplayObjects() != base)
+            errors.push_back("addChild() did not adopt the orphan");
+        root->removeChild(box);
+        if (factory.countOrphanedDisplayObjects() != base + 1)
+            errors.push_back("removeChild() did not orphan the child");
+
+        box->setOrphanRetentionPolicy(IDisplayObject::OrphanRetentionPolicy::RetainUntilManual);
+        factory.collectGarbage();
+        if (!factory.getDisplayObjectPtr(init.name))
+            errors.push_back("RetainUntilManual orphan was collected");
+
+        box->setOrphanGrace(std::chrono::milliseconds(60000));
+        box->setOrphanRetentionPolicy(IDisplayObject::OrphanRetentionPolicy::GracePeriod);
+        factory.collectGarbage();
+        if (!factory.getDisplayObjectPtr(init.name))
+            errors.push_back("GracePeriod orphan was collected before its grace expired");
+
+        box->setOrphanGrace(std::chrono::milliseconds(0));
+        factory.collectGarbage();
+        if (factory.getDisplayObjectPtr(init.name))
+        {
+            errors.push_back("Expired GracePeriod orphan was not collected");
+            factory.destroyDisplayObject(init.name);
+        }
+
+        // A zero budget still makes progress, one object per pass
+        constexpr int kOrphans = 32;
+        for (int i = 0; i < kOrphans; ++i)
+        {
+            init.name = "orphan_budget_box_" + std::to_string(i);
+            factory.createDisplayObject("Box", init);
+        }
+        const auto budget = factory.getGarbageBudget();
+        factory.setGarbageBudget(std::chrono::microseconds(0));
+        const int before = factory.countOrphanedDisplayObjects();
+        factory.collectGarbage();
+        if (factory.countOrphanedDisplayObjects() != before - 1)
+            errors.push_back("A zero GC budget should destroy exactly one due orphan");
+        factory.setGarbageBudget(budget);
+        for (int i = 0; i < kOrphans; ++i)
+            factory.destroyDisplayObject("orphan_budget_box_" + std::to_string(i));
+
+        return true; // ✅ finished this frame
+    } // END: IDisplayObject_test7(std::vector<std::string>& errors)
+
+
+    // ============================================================================
+    //  Test 8: Pooled Display Object Storage
+    // ----------------------------------------------------------------------------
+    //  Display objects come from per-type slabs. A reserved type churns without
+    //  growing its slabs, and Box-sized blocks freed back to the pool are the
+    //  ones handed out again, aligned and without new slabs. With
+    //  BENCHMARK_TEST_OUTPUT it also prints slab vs. global heap allocation cost.
+    // ============================================================================
+    bool IDisplayObject_test8(std::vector<std::string>& errors)
+    {
+        constexpr int kBatch = 256;
+        Factory& factory = getFactory();
+        SlabPool& pool = SlabPool::displayObjects();
+
+        if (!factory.reserveDisplayObjects("Box", kBatch))
+        {
+            errors.push_back("reserveDisplayObjects() failed for Box");
+            return true;
+        }
+
+        // Object churn through the creators stays within the reserved slabs
+        const SlabPool::Stats before = factory.getDisplayObjectPoolStats("Box");
+        {
+            Box::InitStruct init;
+            init.name = "pool_churn_box";
+            std::vector<std::unique_ptr<IDisplayObject>> boxes;
+            boxes.reserve(kBatch);
+            for (int i = 0; i < kBatch; ++i)
+                boxes.push_back(Box::CreateFromInitStruct(init));
+        }
+        const SlabPool::Stats after = factory.getDisplayObjectPoolStats("Box");
+        if (after.slabs != before.slabs)
+            errors.push_back("Reserved Box pool grew during a burst of " + std::to_string(kBatch));
+        if (after.allocations - before.allocations != static_cast<uint64_t>(kBatch))
+            errors.push_back("Box allocations bypassed the slab pool");
+        if (after.live != before.live)
+            errors.push_back("Box pool live count drifted across a burst");
+
+        // Raw blocks of the Box size class: freed blocks are recycled
+        std::vector<void*> blocks(kBatch);
+        for (int i = 0; i < kBatch; ++i) blocks[i] = pool.allocate(sizeof(Box));
+        const SlabPool::Stats held = factory.getDisplayObjectPoolStats("Box");
+        if (held.live != after.live + kBatch)
+            errors.push_back("Box pool live count is " + std::to_string(held.live) + " with " + std::to_string(kBatch) + " blocks held");
+        if (held.slabs != after.slabs)
+            errors.push_back("Reserved Box pool grew while handing out raw blocks");
+        std::unordered_set<void*> first(blocks.begin(), blocks.end());
+        if (first.size() != blocks.size())
+            errors.push_back("Slab pool handed out the same block twice");
+        for (void* block : blocks)
+        {
+            if (reinterpret_cast<std::uintptr_t>(block) % SlabPool::ALIGNMENT != 0)
+            {
+                errors.push_back("Slab pool block is not aligned to SlabPool::ALIGNMENT");
+                break;
+            }
+        }
+        for (int i = 0; i < kBatch; ++i) pool.deallocate(blocks[i], sizeof(Box));
+
+        for (int i = 0; i < kBatch; ++i) blocks[i] = pool.allocate(sizeof(Box));
+        int reused = 0;
+        for (void* block : blocks) reused += first.count(block) ? 1 : 0;
+        if (reused != kBatch)
+            errors.push_back("Only " + std::to_string(reused) + " of " + std::to_string(kBatch) + " freed blocks were reused");
+        for (int i = 0; i < kBatch; ++i) pool.deallocate(blocks[i], sizeof(Box));
+
+        const SlabPool::Stats done = factory.getDisplayObjectPoolStats("Box");
+        if (done.live != after.live || done.slabs != after.slabs)
+            errors.push_back("Box pool did not return to its previous state after raw block churn");
+
+        // Opt-in timing: slab pool vs. global heap for a Box-sized block (never asserted)
+        if constexpr (BENCHMARK_TEST_OUTPUT)
+        {
+            constexpr int kRounds = 200;
+            auto start = std::chrono::steady_clock::now();
+            for (int r = 0; r < kRounds; ++r)
+            {
+                for (int i = 0; i < kBatch; ++i) blocks[i] = pool.allocate(sizeof(Box));
+                for (int i = 0; i < kBatch; ++i) pool.deallocate(blocks[i], sizeof(Box));
+            }
+            auto mid = std::chrono::steady_clock::now();
+            for (int r = 0; r < kRounds; ++r)
+            {
+                for (int i = 0; i < kBatch; ++i) blocks[i] = ::operator new(sizeof(Box));
+                for (int i = 0; i < kBatch; ++i) ::operator delete(blocks[i]);
+            }
+            auto end = std::chrono::steady_clock::now();
+
+            constexpr double kOps = static_cast<double>(kBatch) * kRounds;
+            double poolNs = std::chrono::duration<double, std::nano>(mid - start).count() / kOps;
+            double heapNs = std::chrono::duration<double, std::nano>(end - mid).count() / kOps;
+            const SlabPool::Stats total = factory.getDisplayObjectPoolStats();
+            std::cout << "  Display object storage (" << sizeof(Box) << " B): slab pool " << poolNs
+                      << " ns/alloc+free, global heap " << heapNs << " ns/alloc+free; "
+                      << total.sizeClasses << " size classes, " << total.slabs << " slabs, "
+                      << total.live << " live" << std::endl;
+        }
+
+        return true; // ✅ finished this frame
+    } // END: IDisplayObject_test8(std::vector<std::string>& errors)
+
+
+    // ============================================================================
+    //  Test 9: Bulk Display Object Creation
+    // ----------------------------------------------------------------------------
+    //  createDisplayObjects() builds a batch with one registry reserve and one
+    //  id-lock acquisition. Its handles must match the one-at-a-time path (valid,
+    //  resolvable, same type and geometry, aliasing existing names), a name
+    //  repeated inside a batch aliases its first use, and an invalid name
+    //  rejects the whole batch without registering any of it. With
+    //  BENCHMARK_TEST_OUTPUT it also prints both startup times.
+    // ============================================================================
+    bool IDisplayObject_test9(std::vector<std::string>& errors)
+    {
+        constexpr int kCount = 2000;
+        Factory& factory = getFactory();
+
+        std::vector<Box::InitStruct> singles(kCount), bulk(kCount);
+        for (int i = 0; i < kCount; ++i)
+        {
+            singles[i].name = "startup_single_box_" + std::to_string(i);
+            bulk[i].name = "startup_bulk_box_" + std::to_string(i);
+            bulk[i].x = singles[i].x = static_cast<float>(i % 64) * 8.0f;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (const auto& init : singles)
+            factory.createDisplayObject("Box", init);
+        auto mid = std::chrono::steady_clock::now();
+        std::vector<DisplayHandle> handles =
+            factory.createDisplayObjects(std::span<const Box::InitStruct>(bulk));
+        auto end = std::chrono::steady_clock::now();
+
+        // Opt-in timing: one-at-a-time vs. bulk startup (never asserted)
+        if constexpr (BENCHMARK_TEST_OUTPUT)
+        {
+            double singleMs = std::chrono::duration<double, std::milli>(mid - start).count();
+            double bulkMs = std::chrono::duration<double, std::milli>(end - mid).count();
+            std::cout << "  Startup of " << kCount << " Boxes: one at a time " << singleMs
+                      << " ms, bulk " << bulkMs << " ms" << std::endl;
+        }
+
+        if (handles.size() != static_cast<std::size_t>(kCount))
+            errors.push_back("createDisplayObjects() returned " + std::to_string(handles.size()) + " handles");
+        int bad = 0;
+        for (std::size_t i = 0; i < handles.size(); ++i)
+        {
+            DisplayHandle single = factory.getDisplayObject(singles[i].name);
+            if (!handles[i].isValid() || handles[i].getId() == 0 ||
+                factory.resolveDisplayObjectPtr(handles[i].getId()) != handles[i].get() ||
+                handles[i].getName() != bulk[i].name ||
+                !single.isValid() || handles[i].getType() != single.getType() ||
+                handles[i]->getX() != single->getX() || handles[i]->getParent())
+                ++bad;
+        }
+        if (bad)
+            errors.push_back(std::to_string(bad) + " bulk-created handles did not match the one-at-a-time path");
+
+        // Existing names alias instead of re-initializing
+        std::vector<DisplayHandle> again =
+            factory.createDisplayObjects(std::span<const Box::InitStruct>(bulk.data(), 1));
+        if (again.size() != 1 || again[0].get() != handles[0].get())
+            errors.push_back("Bulk creation of an existing name did not alias it");
+
+        // A name repeated within one batch: the first wins, the second aliases it
+        std::vector<Box::InitStruct> twice(2);
+        twice[0].name = twice[1].name = "startup_twice_box";
+        twice[1].x = 99.0f;
+        std::vector<DisplayHandle> pair =
+            factory.createDisplayObjects(std::span<const Box::InitStruct>(twice));
+        if (pair.size() != 2 || !pair[0].isValid() || pair[1].get() != pair[0].get() || pair[0]->getX() == 99)
+            errors.push_back("A name repeated within a batch did not alias its first use");
+        factory.destroyDisplayObject("startup_twice_box");
+
+        // An empty name rejects the batch before anything is registered
+        std::vector<Box::InitStruct> broken(2);
+        broken[0].name = "startup_rejected_box";
+        broken[1].name = "";
+        bool threw = false;
+        try { factory.createDisplayObjects(std::span<const Box::InitStruct>(broken)); }
+        catch (const std::exception&) { threw = true; }
+        if (!threw)
+            errors.push_back("Bulk creation accepted an empty name");
+        if (factory.getDisplayObject("startup_rejected_box").isValid())
+        {
+            errors.push_back("A rejected batch left an earlier entry registered");
+            factory.destroyDisplayObject("startup_rejected_box");
+        }
+
+        for (int i = 0; i < kCount; ++i)
+        {
+            factory.destroyDisplayObject(singles[i].name);
+            factory.destroyDisplayObject(bulk[i].name);
+        }
+
+        return true; // ✅ finished this frame
+    } // END: IDisplayObject_test9(std::vector<std::string>& errors)
+
+
+    // ============================================================================
+    //  Test 10: Subtree Template Instantiation
+    // ----------------------------------------------------------------------------
+    //  A 200-node row is compiled once as a display template. Instances must
+    //  match a JSON build of the same row (structure, names, geometry, parent
+    //  links), and instantiating leaves the compiled template unchanged, so
+    //  later instances still derive their names from their own roots. With
+    //  BENCHMARK_TEST_OUTPUT it also prints JSON vs. template build times.
+    // ============================================================================
+    bool IDisplayObject_test10(std::vector<std::string>& errors)
+    {
+        constexpr int kCells = 199;
+        constexpr int kCopies = 10;
+        Factory& factory = getFactory();
+
+        nlohmann::json row = { {"type", "Box"}, {"name", "row"}, {"x", 10}, {"y", 20}, {"width", 800}, {"height", 24} };
+        row["children"] = nlohmann::json::array();
+        for (int i = 0; i < kCells; ++i)
+        {
+            row["children"].push_back({ {"type", "Box"}, {"name", "cell_" + std::to_string(i)},
+                                        {"x", 10 + i * 4}, {"y", 20}, {"width", 4}, {"height", 24} });
+        }
+        if (!factory.registerDisplayTemplate("bench_row", row))
+        {
+            errors.push_back("registerDisplayTemplate() rejected a Box row");
+            return true;
+        }
+        if (factory.getDisplayTemplateSize("bench_row") != static_cast<std::size_t>(kCells + 1))
+            errors.push_back("Compiled template has the wrong node count");
+
+        // Reference path: renamed JSON copies, built through the bulk JSON creator
+        std::vector<nlohmann::json> docs(kCopies, row);
+        for (int c = 0; c < kCopies; ++c)
+        {
+            const std::string root = "json_row_" + std::to_string(c);
+            docs[c]["name"] = root;
+            for (auto& cell : docs[c]["children"])
+                cell["name"] = root + "." + cell["name"].get<std::string>();
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<DisplayHandle> jsonRoots;
+        for (const auto& doc : docs)
+        {
+            std::vector<const nlohmann::json*> nodes{ &doc };
+            for (const auto& cell : doc["children"]) nodes.push_back(&cell);
+            std::vector<DisplayHandle> built = factory.createDisplayObjectsFromJson(nodes);
+            for (std::size_t i = 1; i < built.size(); ++i)
+                built[0]->addChild(built[i]);
+            jsonRoots.push_back(built[0]);
+        }
+        auto mid = std::chrono::steady_clock::now();
+        std::vector<DisplayHandle> rows = factory.instantiateDisplayTemplates("bench_row", kCopies);
+        auto end = std::chrono::steady_clock::now();
+
+        // Opt-in timing: building from JSON vs. cloning the compiled template (never asserted)
+        if constexpr (BENCHMARK_TEST_OUTPUT)
+        {
+            double jsonMs = std::chrono::duration<double, std::milli>(mid - start).count();
+            double cloneMs = std::chrono::duration<double, std::milli>(end - mid).count();
+            std::cout << "  " << kCopies << " rows of " << (kCells + 1) << " nodes: from JSON " << jsonMs
+                      << " ms, from template " << cloneMs << " ms" << std::endl;
+        }
+
+        if (rows.size() != static_cast<std::size_t>(kCopies))
+            errors.push_back("instantiateDisplayTemplates() returned " + std::to_string(rows.size()) + " roots");
+        for (std::size_t r = 0; r < rows.size(); ++r)
+        {
+            if (!rows[r].isValid() || rows[r]->getChildren().size() != static_cast<std::size_t>(kCells))
+            {
+                errors.push_back("Template instance " + std::to_string(r) + " is missing children");
+                continue;
+            }
+            const auto& cells = rows[r]->getChildren();
+            const auto& twins = jsonRoots[r]->getChildren();
+            if (rows[r]->getX() != jsonRoots[r]->getX() || rows[r]->getWidth() != jsonRoots[r]->getWidth())
+                errors.push_back("Template instance root geometry differs from the JSON build");
+            if (twins.size() != cells.size())
+            {
+                errors.push_back("JSON build " + std::to_string(r) + " has " + std::to_string(twins.size()) + " children");
+                continue;
+            }
+            for (int i = 0; i < kCells; ++i)
+            {
+                if (cells[i].getName() != rows[r].getName() + ".cell_" + std::to_string(i) ||
+                    cells[i]->getParent().get() != rows[r].get() || cells[i].getType() != twins[i].getType() ||
+                    cells[i]->getX() != twins[i]->getX() || cells[i]->getWidth() != twins[i]->getWidth())
+                {
+                    errors.push_back("Template instance " + std::to_string(r) + " cell " + std::to_string(i)
+                                     + " differs from the JSON build");
+                    break;
+                }
+            }
+        }
+        if (factory.getDisplayTemplateSize("bench_row") != static_cast<std::size_t>(kCells + 1))
+            errors.push_back("Instantiation changed the compiled template");
+
+        // Explicit instance names must be free
+        DisplayHandle named = factory.instantiateDisplayTemplate("bench_row", "named_row");
+        if (!named.isValid() || !factory.getDisplayObject("named_row.cell_0").isValid())
+            errors.push_back("instantiateDisplayTemplate() with a name failed");
+        if (factory.instantiateDisplayTemplate("bench_row", "named_row").isValid())
+            errors.push_back("instantiateDisplayTemplate() reused a taken instance name");
+
+        rows.push_back(named);
+        rows.insert(rows.end(), jsonRoots.begin(), jsonRoots.end());
+        for (DisplayHandle& root : rows)
+        {
+            if (!root.isValid()) continue;
+            std::vector<std::string> names;
+            for (const auto& cell : root->getChildren()) names.push_back(cell.getName());
+            for (const auto& cellName : names) factory.destroyDisplayObject(cellName);
+            factory.destroyDisplayObject(root.getName());
+        }
+        factory.unregisterDisplayTemplate("bench_row");
+
+        return true; // ✅ finished this frame
+    } // END: IDisplayObject_test10(std::vector<std::string>& errors)
+
+
+    // ============================================================================
+    //  Test 11: Interned Type Atoms
+    // ----------------------------------------------------------------------------
+    //  Display object, handle and event type names are interned Atoms. Objects
+    //  of one type share a single atom, handles carry it without re-interning,
+    //  Atom::find() and creator lookups never grow the table, and filtering the display list by
+    //  type atom selects exactly the objects a type-string compare selects.
+    //  With BENCHMARK_TEST_OUTPUT it also prints atom vs. string compare cost.
+    // ============================================================================
+    bool IDisplayObject_test11(std::vector<std::string>& errors)
+    {
+        Factory& factory = getFactory();
+
+        Box::InitStruct init;
+        init.name = "atom_box";
+        DisplayHandle box = factory.createDisplayObject("Box", init);
+        if (!box.isValid())
+        {
+            errors.push_back("Unable to create atom_box");
+            return true;
+        }
+
+        const Atom boxType("Box");
+        if (box->getTypeAtom() != boxType || box.getTypeAtom() != boxType)
+            errors.push_back("Box object and handle do not share the interned type");
+        if (factory.getDisplayObject("atom_box").getTypeAtom() != boxType)
+            errors.push_back("Registry handles lost the interned type");
+        if (box->getType() != "Box" || boxType.view() != "Box")
+            errors.push_back("Interned type does not read back as 'Box'");
+        if (Atom() != Atom("") || !Atom().str().empty())
+            errors.push_back("Empty atom is not the empty string");
+        if (EventType::MouseEnter.getNameAtom() != Atom(EventType::MouseEnter.getName()))
+            errors.push_back("EventType name is not interned");
+
+        const std::size_t interned = Atom::count();
+        if (!Atom::find("atom_test_never_interned").empty() || Atom::count() != interned)
+            errors.push_back("Atom::find() added to the atom table");
+
+        // Re-interning known text returns the same entry and adds nothing
+        if (Atom("Box").id() == 0 || Atom("Box").id() != boxType.id() || Atom::count() != interned)
+            errors.push_back("Re-interning 'Box' produced a different atom");
+
+        // A second Box shares the atom rather than holding its own copy
+        init.name = "atom_box_2";
+        DisplayHandle second = factory.createDisplayObject("Box", init);
+        if (!second.isValid() || second->getTypeAtom() != box->getTypeAtom() ||
+            &second->getType() != &box->getType())
+            errors.push_back("Two Boxes do not share one interned type");
+
+        // Creator lookups go through the atom table without adding to it
+        init.name = "atom_unknown_type";
+        if (factory.createDisplayObject("AtomTestNoSuchType", init).isValid())
+            errors.push_back("An unregistered type produced an object");
+        if (Atom::count() != interned)
+            errors.push_back("Creating objects grew the atom table by " + std::to_string(Atom::count() - interned));
+
+        // Type filtering over the display list: atom and string compares agree
+        std::vector<IDisplayObject*> objects;
+        for (const std::string& name : factory.getDisplayObjectNames())
+            if (IDisplayObject* obj = factory.getDisplayObjectPtr(name)) objects.push_back(obj);
+        std::size_t byAtom = 0, byString = 0;
+        for (IDisplayObject* obj : objects)
+        {
+            const bool atomMatch = (obj->getTypeAtom() == boxType);
+            const bool stringMatch = (obj->getType() == "Box");
+            byAtom += atomMatch;
+            byString += stringMatch;
+            if (atomMatch != stringMatch)
+            {
+                errors.push_back("Atom and string type filters disagree on '" + obj->getName() + "'");
+                break;
+            }
+        }
+        if (byAtom < 2 || byAtom != byString)
+            errors.push_back("Type filter found " + std::to_string(byAtom) + " Boxes by atom, "
+                             + std::to_string(byString) + " by string");
+
+        // Opt-in timing: atom compare vs. string compare over the display list (never asserted)
+        if constexpr (BENCHMARK_TEST_OUTPUT)
+        {
+            constexpr int kRounds = 2000;
+            const std::string boxName = "Box";
+            volatile std::size_t sink = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (int r = 0; r < kRounds; ++r)
+                for (IDisplayObject* obj : objects) sink = sink + (obj->getTypeAtom() == boxType);
+            auto mid = std::chrono::steady_clock::now();
+            for (int r = 0; r < kRounds; ++r)
+                for (IDisplayObject* obj : objects) sink = sink + (obj->getType() == boxName);
+            auto end = std::chrono::steady_clock::now();
+            (void)sink;
+
+            const double ops = static_cast<double>(kRounds) * std::max<std::size_t>(objects.size(), 1);
+            double atomNs = std::chrono::duration<double, std::nano>(mid - start).count() / ops;
+            double stringNs = std::chrono::duration<double, std::nano>(end - mid).count() / ops;
+            std::cout << "  Type filter over " << objects.size() << " objects: atom " << atomNs
+                      << " ns/object, string " << stringNs << " ns/object; "
+                      << Atom::count() << " atoms interned" << std::endl;
+        }
+
+        factory.destroyDisplayObject("atom_box_2");
+        factory.destroyDisplayObject("atom_box");
+        return true; // ✅ finished this frame
+    } // END: IDisplayObject_test11(std::vector<std::string>& errors)
+
+
+    // ============================================================================
+    //  Test 12: Cached Subtree Across the Stage Edge
+    // ----------------------------------------------------------------------------
+    //  A cacheAsBitmap panel dragged partly off the left edge is drawn live while
+    //  its origin is negative (its cache could not hold the off-stage strip),
+    //  and its cache is repainted once it is dragged back. Re-entrant: one step
+    //  per frame.
+    // ============================================================================
+    bool IDisplayObject_test12(std::vector<std::string>& errors)
+    {
+        static int step = 0;
+        static DisplayHandle panel;
+        static DisplayHandle child;
+        Factory& factory = getFactory();
+        Core& core = getCore();
+
+        switch (step++)
+        {
+            case 0:
+            {
+                Box::InitStruct init;
+                init.name = "cache_edge_panel";
+                init.x = 8.0f;  init.y = 8.0f;
+                init.width = 64.0f;  init.height = 48.0f;
+                panel = factory.createDisplayObject("Box", init);
+                init.name = "cache_edge_child";
+                init.x = 10.0f;  init.y = 16.0f;
+                init.width = 16.0f;  init.height = 16.0f;
+                child = factory.createDisplayObject("Box", init);
+                if (!panel || !child || !core.getRootNodePtr())
+                {
+                    errors.push_back("Failed to create the cached panel");
+                    return true;
+                }
+                panel->addChild(child);
+                panel->setCacheAsBitmap(true);
+                core.getRootNodePtr()->addChild(panel);
+                return false;
+            }
+            case 1:
+                return false;   // build the cache
+            case 2:
+            {
+                if (core.getRedrawStatsLastFrame().cachedSubtrees < 1)
+                    errors.push_back("On-stage panel was not drawn from its cache");
+                panel->setX(-20);   // the child stays on stage, at x = -18
+                return false;
+            }
+            case 3:
+            {
+                Core::RedrawStats stats = core.getRedrawStatsLastFrame();
+                if (stats.cachedSubtrees != 0)
+                    errors.push_back("Panel partly off the left edge was still drawn from its cache");
+                panel->setX(8);
+                return false;
+            }
+            default:
+                break;
+        }
+
+        // Same size and layout as before the drag, but the cache must not be trusted
+        Core::RedrawStats stats = core.getRedrawStatsLastFrame();
+        if (stats.cachedSubtrees < 1)
+            errors.push_back("Panel back on stage was not drawn from its cache");
+        if (stats.cacheRebuilds < 1)
+            errors.push_back("Panel back on stage reused the cache from before the drag");
+
+        core.getRootNodePtr()->removeChild(panel);
+        factory.destroyDisplayObject(child.getName());
+        factory.destroyDisplayObject(panel.getName());
+        return true; // ✅ finished
+    } // END: IDisplayObject_test12(std::vector<std::string>& errors)
+
+
+    // ============================================================================
+    //  Test 13: Handles Across a Recreated Name
+    // ----------------------------------------------------------------------------
+    //  A Factory-minted handle pins its object by slot id and stays null once the
+    //  object is destroyed, even after the name is reused. A handle built from the
+    //  name alone follows the name to the new object.
+    // ============================================================================
+    bool IDisplayObject_test13(std::vector<std::string>& errors)
+    {
+        Factory& factory = getFactory();
+
+        Box::InitStruct init;
+        init.name = "handle_rename_box";
+        init.x = 1.0f;
+        DisplayHandle minted = factory.createDisplayObject("Box", init);
+        DisplayHandle byName(init.name, "Box");
+        if (!minted.isValid() || byName.get() != minted.get())
+        {
+            errors.push_back("Name-built handle did not resolve to the created Box");
+            factory.destroyDisplayObject(init.name);
+            return true;
+        }
+
+        factory.destroyDisplayObject(init.name);
+        if (minted.isValid() || byName.isValid())
+            errors.push_back("Handles still resolve after the Box was destroyed");
+
+        init.x = 2.0f;
+        DisplayHandle again = factory.createDisplayObject("Box", init);
+        if (!again.isValid())
+        {
+            errors.push_back("Unable to recreate " + init.name);
+            return true;
+        }
+        if (minted.isValid())
+            errors.push_back("Minted handle aliased a new object that reused its name");
+        if (byName.get() != again.get() || byName->getX() != 2)
+            errors.push_back("Name-built handle did not follow its name to the recreated Box");
+
+        factory.destroyDisplayObject(init.name);
+        return true; // ✅ finished this frame
+    } // END: IDisplayObject_test13(std::vector<std::string>& errors)
+
+
+    // ============================================================================
+    //  Test 14: Z-Order Change Rebuilds the Render List
+    // ----------------------------------------------------------------------------
+    //  Raising a child with setZOrder() invalidates the render list at once, so
+    //  the very next frame rebuilds it in the new sibling order instead of
+    //  drawing one frame in the old order. Re-entrant: one step per frame.
+    // ============================================================================
+    bool IDisplayObject_test14(std::vector<std::string>& errors)
+    {
+        static int step = 0;
+        static int rebuilds = 0;
+        static DisplayHandle parent;
+        static DisplayHandle low;
+        static DisplayHandle high;
+        Factory& factory = getFactory();
+        Core& core = getCore();
+
+        switch (step++)
+        {
+            case 0:
+            {
+                Box::InitStruct init;
+                init.name = "zorder_parent";
+                init.width = 32.0f;  init.height = 32.0f;
+                parent = factory.createDisplayObject("Box", init);
+                init.name = "zorder_low";
+                low = factory.createDisplayObject("Box", init);
+                init.name = "zorder_high";
+                high = factory.createDisplayObject("Box", init);
+                if (!parent || !low || !high || !core.getRootNodePtr())
+                {
+                    errors.push_back("Failed to create the z-order boxes");
+                    return true;
+                }
+                parent->addChild(low);
+                parent->addChild(high);
+                core.getRootNodePtr()->addChild(parent);
+                return false;
+            }
+            case 1:
+            {
+                rebuilds = core.getRenderListRebuildCount();
+                low->setZOrder(high->getZOrder() + 1);
+                return false;
+            }
+            default:
+                break;
+        }
+
+        if (core.getRenderListRebuildCount() == rebuilds)
+            errors.push_back("setZOrder() did not rebuild the render list on the next frame");
+        const auto& kids = parent->getChildren();
+        if (kids.empty() || kids.back().get() != low.get())
+            errors.push_back("Raised child is not last in sibling order after one frame");
+
+        core.getRootNodePtr()->removeChild(parent);
+        factory.destroyDisplayObject(high.getName());
+        factory.destroyDisplayObject(low.getName());
+        factory.destroyDisplayObject(parent.getName());
+        return true; // ✅ finished
+    } // END: IDisplayObject_test14(std::vector<std::string>& errors)
+
+
     // --- Lua Integration Tests --- //
 
     bool IDisplayObject_LUA_Tests(std::vector<std::string>& errors)
@@ -70,6 +1218,20 @@ namespace SDOM
         if (!registered)
         {
             ut.add_test(objName, "Scaffold", IDisplayObject_test0);
+            ut.add_test(objName, "World bounds cache (20-deep chain)", IDisplayObject_test1);
+            ut.add_test(objName, "Hit-test index parity", IDisplayObject_test2);
+            ut.add_test(objName, "Listener subscription index", IDisplayObject_test3);
+            ut.add_test(objName, "Listener dispatch by EventType id", IDisplayObject_test4);
+            ut.add_test(objName, "Subtree bitmap cache", IDisplayObject_test5);
+            ut.add_test(objName, "Child clipping and culling", IDisplayObject_test6);
+            ut.add_test(objName, "Incremental orphan tracking", IDisplayObject_test7);
+            ut.add_test(objName, "Pooled display object storage", IDisplayObject_test8);
+            ut.add_test(objName, "Bulk display object creation", IDisplayObject_test9);
+            ut.add_test(objName, "Subtree template instantiation", IDisplayObject_test10);
+            ut.add_test(objName, "Interned type atoms", IDisplayObject_test11);
+            ut.add_test(objName, "Cached subtree across the stage edge", IDisplayObject_test12);
+            ut.add_test(objName, "Handles across a recreated name", IDisplayObject_test13);
+            ut.add_test(objName, "Z-order change rebuilds the render list", IDisplayObject_test14);
 
             // ut.add_test(objName, "Lua: 'src/IDisplayObject_UnitTests.lua'", IDisplayObject_LUA_Tests, false); 
 
@@ -153,6 +153,43 @@ namespace SDOM
             }
         }
 
+        bool SpriteSheet_GeometryBatch(std::vector<std::string>& errors)
+        {
+            AssetHandle handle = getCore().getFactory().getAssetObject("external_icon_8x8");
+            SpriteSheet* ss = handle.as<SpriteSheet>();
+            SDL_Renderer* renderer = getRenderer();
+            if (!ss || !ss->getTexture() || !renderer || ss->getSpriteCount() <= 0)
+                return true; // nothing to draw with
+
+            // Draw off-screen so the test leaves no pixels behind
+            SDL_Texture* target = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, 64, 64);
+            if (!target)
+            {
+                errors.push_back(std::string("Unable to create batch test target: ") + SDL_GetError());
+                return true;
+            }
+            SDL_Texture* prevTarget = SDL_GetRenderTarget(renderer);
+            SDL_SetRenderTarget(renderer, target);
+
+            SpriteBatch& batch = getCore().getSpriteBatch();
+            const SpriteBatch::Stats before = batch.getStats();
+            {
+                SpriteBatch::Scope scope(batch);
+                for (int i = 0; i < 2000; ++i)
+                    ss->drawSprite(i % ss->getSpriteCount(), (i % 8) * 8, (i / 8 % 8) * 8, SDL_Color{ 255, 255, 255, 255 });
+            }
+            const SpriteBatch::Stats after = batch.getStats();
+
+            SDL_SetRenderTarget(renderer, prevTarget);
+            SDL_DestroyTexture(target);
+
+            if (after.quads - before.quads != 2000)
+                errors.push_back("Expected 2000 batched quads; got " + std::to_string(after.quads - before.quads));
+            if (after.drawCalls - before.drawCalls != 1)
+                errors.push_back("Expected 2000 sprites to submit in 1 draw call; got " + std::to_string(after.drawCalls - before.drawCalls));
+            return true;
+        }
+
     } // namespace
 
 
@@ -166,6 +203,7 @@ namespace SDOM
         {
             ut.add_test(objName, "Missing texture logs and returns 0 sprites", SpriteSheet_MissingTexture);
             ut.add_test(objName, "Size query failure returns 0 sprites", SpriteSheet_SizeQueryFailure);
+            ut.add_test(objName, "Sprites batch into one geometry call", SpriteSheet_GeometryBatch);
             registered = true;
         }
 
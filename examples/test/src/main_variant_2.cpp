@@ -241,7 +241,9 @@ int SDOM_main_variant_2(int argc, char** argv)
     // Register minimal types needed by tests
     core.getFactory().registerDisplayObjectType("Box", TypeCreators{
         Box::CreateFromInitStruct,
-        Box::CreateFromJson
+        Box::CreateFromJson,
+        sizeof(Box),
+        ParseInitStruct<Box>
     });
 
 
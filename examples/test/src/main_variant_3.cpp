@@ -64,7 +64,9 @@ namespace
     {
         core.getFactory().registerDisplayObjectType("Box", TypeCreators{
             Box::CreateFromInitStruct,
-            Box::CreateFromJson
+            Box::CreateFromJson,
+            sizeof(Box),
+            ParseInitStruct<Box>
         });
     }
 }
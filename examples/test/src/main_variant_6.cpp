@@ -28,7 +28,9 @@ int SDOM_main_variant_6(int argc, char** argv)
     Core& core = Core::getInstance();
     core.getFactory().registerDisplayObjectType("Box", TypeCreators{
         Box::CreateFromInitStruct,
-        Box::CreateFromJson
+        Box::CreateFromJson,
+        sizeof(Box),
+        ParseInitStruct<Box>
     });
 
     // Load configuration
@@ -20,6 +20,7 @@ typedef struct SDOM_CoreConfig {
     SDL_WindowFlags windowFlags;
     SDL_PixelFormat pixelFormat;
     SDL_Color color;
+    int headless;
 } SDOM_CoreConfig;
 
 #define SDOM_CORECONFIG_DEFAULT  { \
@@ -30,7 +31,8 @@ typedef struct SDOM_CoreConfig {
     SDL_LOGICAL_PRESENTATION_LETTERBOX, \
     SDL_WINDOW_RESIZABLE, \
     SDL_PIXELFORMAT_RGBA8888, \
-    { 32, 32, 32, 255 } \
+    { 32, 32, 32, 255 }, \
+    0 \
 }
 
 #ifdef __cplusplus
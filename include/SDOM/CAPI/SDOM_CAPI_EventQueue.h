@@ -0,0 +1,49 @@
+#pragma once
+// SDOM C API module: EventQueue
+// Hand-written (not produced by the bind generator); implemented in src/SDOM_EventManager.cpp.
+// These entry points are safe to call from any thread and never take a global lock.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <SDOM/CAPI/SDOM_CAPI_Event.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct SDOM_EventQueueStats {
+    uint64_t posted;        ///< Posts accepted into the cross-thread queue.
+    uint64_t rejected;      ///< Posts refused because the queue was full (back-pressure).
+    uint64_t drained;       ///< Posts moved into the main event queue.
+    uint64_t highWater;     ///< Largest backlog drained in a single frame.
+    uint64_t capacity;      ///< Fixed capacity of the cross-thread queue.
+} SDOM_EventQueueStats;
+
+/**
+ * @brief Posts an event from any thread; it is dispatched on the next frame.
+ *
+ * C++:   bool EventManager::postEvent(uint32_t typeId, uint64_t targetId, const char* payloadJson)
+ * C API: bool SDOM_PostEvent(SDOM_EventType type, uint64_t target_id, const char* payload_json)
+ *
+ * @param type Event type id.
+ * @param target_id Display object id (SDOM_DisplayHandle::object_id); 0 targets the stage.
+ * @param payload_json Optional JSON object stored as the event payload (copied; may be NULL).
+ * @return false if SDOM is not initialized, the type is invalid, or the queue is full.
+ */
+bool SDOM_PostEvent(SDOM_EventType type, uint64_t target_id, const char* payload_json);
+
+/**
+ * @brief Retrieves back-pressure statistics for the cross-thread event queue.
+ *
+ * C++:   EventManager::PostQueueStats EventManager::getPostQueueStats() const
+ * C API: bool SDOM_GetEventQueueStats(SDOM_EventQueueStats* out_stats)
+ *
+ * @param out_stats Receives the current counters.
+ * @return false if out_stats is NULL or SDOM is not initialized.
+ */
+bool SDOM_GetEventQueueStats(SDOM_EventQueueStats* out_stats);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
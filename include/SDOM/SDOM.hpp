@@ -83,6 +83,7 @@
 
 // Garbage Collection / Orphan Retention
 constexpr int ORPHAN_GRACE_PERIOD = 5000; // default grace period for orphaned objects (in milliseconds)
+constexpr int GC_FRAME_BUDGET = 1000;     // default per-frame time slice for destroying orphans (in microseconds)
 
 /**
  * @namespace SDOM
@@ -171,6 +172,9 @@ namespace SDOM
      * - Designed for build servers, CI systems, or silent regression runs where
      *   concise output is preferred.
      * - These flags do **not** affect SDL, Lua, or other runtime logging systems.
+     * - `BENCHMARK_TEST_OUTPUT` is independent of both: when enabled, tests that
+     *   carry a micro-benchmark also time it and print the measurements. Timings
+     *   are informational only and never fail a test.
      */
 
     // ----------------------------------------------------------------------
@@ -206,6 +210,22 @@ namespace SDOM
         inline constexpr bool QUIET_TEST_MODE = SDOM_QUIET_TEST_MODE;
     #endif
 
+    // ----------------------------------------------------------------------
+    // Benchmark Output Control (opt-in)
+    // ----------------------------------------------------------------------
+    #ifndef SDOM_BENCHMARK_TEST_OUTPUT
+        /**
+         * @brief Runs and prints the timing sections of unit tests.
+         * @details
+         * When `true`, tests that compare a fast path against its predecessor
+         * time both and print the results. The assertions never depend on the
+         * timings, so the suite passes or fails the same way either way.
+         */
+        inline constexpr bool BENCHMARK_TEST_OUTPUT = false;
+    #else
+        inline constexpr bool BENCHMARK_TEST_OUTPUT = SDOM_BENCHMARK_TEST_OUTPUT;
+    #endif
+
 
     // ======================================================================
     // 🧩 Core Runtime Timing Defaults
@@ -0,0 +1,84 @@
+#pragma once
+/***  SDOM_Atom.hpp  ****************************
+ *
+ * Interned strings for identifiers drawn from a small, fixed vocabulary:
+ * display object type names and event type names.
+ *
+ * Atom("Button") looks the text up in a process-wide table once and keeps a
+ * pointer to the single stored copy. After that, copying an atom is a
+ * pointer copy, comparing two atoms is a pointer compare, and hashing one
+ * hashes the pointer, so hot paths that used to copy and re-hash type names
+ * (handle copies, hover type checks) no longer touch the characters. str()
+ * and view() hand the text back for display and for string-based APIs.
+ *
+ * Interned text is never freed. Do not intern unbounded sets such as object
+ * names generated at runtime; those stay std::string.
+ *
+ * Interning is thread safe (readers share a lock, new text takes it
+ * exclusively). Reading an atom needs no lock. The default atom is the
+ * empty string.
+ *
+ * Released under the ZLIB License.
+ * Original Author: Jay Faries (warte67)
+ *
+ ******************/
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace SDOM
+{
+    class Atom
+    {
+    public:
+        Atom() = default;
+        explicit Atom(std::string_view text) : entry_(intern_(text)) {}
+
+        // The atom for `text` if it has been interned, else the empty atom.
+        // Never adds to the table.
+        static Atom find(std::string_view text);
+
+        // Number of distinct non-empty strings interned so far
+        static std::size_t count();
+
+        const std::string& str() const { return entry_ ? entry_->text : empty_(); }
+        std::string_view view() const { return str(); }
+        std::uint32_t id() const { return entry_ ? entry_->id : 0; }  // dense, 0 for empty
+        bool empty() const { return entry_ == nullptr; }
+
+        bool operator==(const Atom& other) const { return entry_ == other.entry_; }
+        bool operator!=(const Atom& other) const { return entry_ != other.entry_; }
+
+    private:
+        struct Entry
+        {
+            std::string text;
+            std::uint32_t id = 0;
+        };
+
+        struct Table;
+
+        explicit Atom(const Entry* entry) : entry_(entry) {}
+
+        static Table& table_();
+        static const Entry* intern_(std::string_view text);
+        static const std::string& empty_();
+
+        const Entry* entry_ = nullptr;
+
+        friend struct std::hash<Atom>;
+    }; // END: class Atom
+
+} // END: namespace SDOM
+
+template<>
+struct std::hash<SDOM::Atom>
+{
+    std::size_t operator()(const SDOM::Atom& atom) const noexcept
+    {
+        return std::hash<const void*>{}(atom.entry_);
+    }
+};
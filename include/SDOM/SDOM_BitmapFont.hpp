@@ -185,7 +185,12 @@ namespace SDOM
         int bitmapFontWidth_ = -1;
         int bitmapFontHeight_ = -1;
 
-        std::vector<std::vector<SDL_Texture*>> outlineTextures;
+        // One atlas page per outline thickness; glyph i lives in the cell
+        // returned by outlineCellRect_() so whole outline passes batch together.
+        std::vector<SDL_Texture*> outlineTextures;
+        static constexpr int OUTLINE_ATLAS_COLUMNS = 16;
+        static constexpr int OUTLINE_CELL_GUTTER = 1;   // transparent texels between cells
+        SDL_FRect outlineCellRect_(int thickness, int spriteIndex) const;
         int activeFontWidth_ = -1;
         int activeFontHeight_ = -1;
 
@@ -6,12 +6,16 @@
 #include <mutex>
 #include <queue>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <SDOM/SDOM_IDataObject.hpp>
 #include <SDOM/SDOM_DataRegistry.hpp>
 #include <SDOM/SDOM_IDisplayObject.hpp>
 #include <SDOM/SDOM_IAssetObject.hpp>
 #include <SDOM/SDOM_Factory.hpp>
+#include <SDOM/SDOM_SpriteBatch.hpp>
+#include <SDOM/SDOM_RenderCommandBuffer.hpp>
+#include <SDOM/SDOM_TexturePool.hpp>
 // #include <SDOM/SDOM_DisplayHandle.hpp>
 
 #include <SDOM/SDOM_Utils.hpp>
@@ -107,6 +111,26 @@ namespace SDOM
             SDL_WindowFlags windowFlags = SDL_WINDOW_RESIZABLE;
             SDL_PixelFormat pixelFormat = SDL_PIXELFORMAT_RGBA8888;
             SDL_Color color = { 32, 32, 32, 255 }; // background color
+            // headless:
+            //  Run without a display. SDL is started on the offscreen (or dummy)
+            //  video driver, the window stays hidden, and the software renderer
+            //  draws into a CPU surface instead of presenting. Each frame the
+            //  stage texture is resolved into that surface; read it through
+            //  getFrameBuffer(). Only honored before SDL video is initialized.
+            bool headless = false;
+        };
+
+        // Read-only view of the headless frame buffer (no copy). Valid until
+        // the next frame or reconfigure; empty when not headless.
+        struct FrameBuffer
+        {
+            const void* pixels = nullptr;
+            int width = 0;
+            int height = 0;
+            int pitch = 0;              // bytes per row
+            SDL_PixelFormat format = SDL_PIXELFORMAT_UNKNOWN;
+
+            explicit operator bool() const { return pixels != nullptr; }
         };
 
         // --- Singleton Access --- //
@@ -142,7 +166,7 @@ namespace SDOM
         // --- Callback/Hook Registration --- //
         void registerOnInit(std::function<bool()> fn) { fnOnInit = fn; }
         void registerOnQuit(std::function<void()> fn) { fnOnQuit = fn; }
-        void registerOnUpdate(std::function<void(float)> fn) { fnOnUpdate = fn; }
+        void registerOnUpdate(std::function<void(float)> fn) { fnOnUpdate = fn; }   // skipped while idle; see setIdleMode()
         void registerOnEvent(std::function<void(const Event&)> fn) { fnOnEvent = fn; }
         void registerOnRender(std::function<void()> fn) { fnOnRender = fn; }
         void registerOnUnitTest(std::function<bool()> fn) { fnOnUnitTest = fn; }
@@ -182,6 +206,12 @@ namespace SDOM
         SDL_Window* getWindow() const       { return window_; }
         SDL_Renderer* getRenderer() const   { return renderer_; }
         SDL_Texture* getTexture() const     { return texture_; }
+        SpriteBatch& getSpriteBatch()       { return spriteBatch_; }
+        RenderCommandBuffer& getRenderCommands() { return renderCommands_; }
+        TexturePool& getTexturePool()       { return texturePool_; }
+        bool isHeadless() const             { return headless_; }
+        FrameBuffer getFrameBuffer() const;
+        bool saveFrameBuffer(const std::string& bmpPath) const;   // headless only
         SDL_Color getColor() const          { return config_.color; }
         void setColor(const SDL_Color& color) { config_.color = color; }
 
@@ -240,6 +270,88 @@ namespace SDOM
         bool getIsTraversing() const { return isTraversing_; }
         void setIsTraversing(bool traversing) { isTraversing_ = traversing; }
 
+        // --- Render List --- //
+        // The active stage is flattened into a linear draw list that is only
+        // rebuilt after the hierarchy, sibling order, or active stage changes.
+        // Pass objectsDestroyed=true when cached object pointers may dangle.
+        void invalidateRenderList(bool objectsDestroyed = false);
+        size_t getRenderListSize() const { return renderList_.size(); }
+        int getRenderListRebuildCount() const { return renderListRebuilds_; }
+
+        // --- Batched SDL Dispatch --- //
+        // When enabled, run() drains every pending SDL event first, merges them
+        // according to each EventType's BatchPolicy, and dispatches the queue once
+        // per frame instead of once per polled event.
+        void setSDLEventBatching(bool enabled) { sdlEventBatching_ = enabled; }
+        bool isSDLEventBatching() const { return sdlEventBatching_; }
+        int getSDLEventsPolledLastFrame() const { return sdlEventsPolledLastFrame_; }
+        int getSDLEventsDispatchedLastFrame() const { return sdlEventsDispatchedLastFrame_; }
+
+        // --- Dirty-Rectangle Redraw --- //
+        // When enabled, the stage texture keeps last frame's pixels and
+        // onRender() repaints only damaged regions, clipped, falling back to a
+        // full redraw when damage covers more than the threshold fraction of
+        // the stage. Damage is found by comparing each node's bounds, dirty
+        // flag and focus state with what was drawn last frame; nodes leaving
+        // the render list damage their old bounds. Drawing done by
+        // registerOnRender() callbacks is not tracked: report it with
+        // addDamage() or call invalidateAll().
+        struct RedrawStats
+        {
+            bool fullRedraw = true;
+            int damageRects = 0;            // clipped passes after merging
+            float damagedFraction = 1.0f;   // share of the stage repainted
+            int nodesVisited = 0;           // render-list nodes examined by the passes
+            int nodesDrawn = 0;             // onRender() calls
+            int nodesSkipped = 0;           // nodes outside every damaged rect
+            int nodesCulled = 0;            // nodes in subtrees outside the stage or a clipping ancestor
+            int cachedSubtrees = 0;         // cacheAsBitmap subtrees blitted
+            int cacheRebuilds = 0;          // of those, re-rendered this frame
+        };
+        void setDirtyRectRedraw(bool enabled) { dirtyRectRedraw_ = enabled; redrawAll_ = true; }
+        bool isDirtyRectRedraw() const { return dirtyRectRedraw_; }
+        void setDirtyRectThreshold(float fraction);
+        float getDirtyRectThreshold() const { return dirtyRectThreshold_; }
+        void addDamage(const SDL_FRect& worldRect);
+        void invalidateAll() { redrawAll_ = true; }
+        RedrawStats getRedrawStatsLastFrame() const { return redrawStats_; }
+
+        // --- Idle Mode --- //
+        // When enabled, run() skips update, render and present while nothing
+        // needs a frame: no display object was marked dirty since the last
+        // render pass, no events are queued or posted, no frame was requested
+        // and no wakeup is due. It blocks in SDL_WaitEventTimeout() until input
+        // arrives, a worker thread posts an event, or the next scheduled wakeup
+        // (at most idleMaxWait ms). Update callbacks (registerOnUpdate() and
+        // IDisplayObject::onUpdate()) are not work by themselves and do not run
+        // while idle: code that animates from them must call setDirty() on what
+        // it changes, requestFrame(), or scheduleWakeup() to keep frames coming.
+        void setIdleMode(bool enabled);
+        bool isIdleMode() const { return idleMode_; }
+        void setIdleMaxWait(Uint32 ms) { idleMaxWaitMs_ = ms; }
+        Uint32 getIdleMaxWait() const { return idleMaxWaitMs_; }
+        void requestFrame() { frameRequested_ = true; }     // main thread
+        void scheduleWakeup(float seconds);                 // main thread
+        void wakeFromIdle();                                // any thread
+        bool wouldIdle() const;     // true if the next frame would be skipped
+        Uint64 getIdleSkippedFrames() const { return idleSkippedFrames_; }
+
+        // --- Cross-thread Posting --- //
+        // Held by the posting C API (SDOM_PostEvent) while it uses the
+        // EventManager from a worker thread. get() is nullptr once teardown
+        // has begun; Core waits for live guards before deleting the manager.
+        class PostGuard
+        {
+        public:
+            PostGuard() { postsInFlight_.fetch_add(1); em_ = postTarget_.load(); }
+            ~PostGuard() { postsInFlight_.fetch_sub(1); }
+            PostGuard(const PostGuard&) = delete;
+            PostGuard& operator=(const PostGuard&) = delete;
+            EventManager* get() const { return em_; }
+        private:
+            EventManager* em_ = nullptr;
+        };
+
         // --- Focus & Hover Management --- //
         void handleTabKeyPress();
         void handleTabKeyPressReverse();
@@ -378,6 +490,8 @@ namespace SDOM
         SDL_Window* window_ = nullptr;
         SDL_Renderer* renderer_ = nullptr;
         SDL_Texture* texture_ = nullptr;
+        SDL_Surface* framebuffer_ = nullptr;    // software renderer target (headless)
+        bool headless_ = false;                 // fixed when SDL video starts
         std::string windowTitle_ = "SDOM Application";
         SDL_Color color_ = { 0, 0, 0, 255 }; // Default BLACK background color
 
@@ -413,6 +527,93 @@ namespace SDOM
         DisplayHandle hoveredObject_;
         DisplayHandle keyboardFocusedObject_;
 
+        // --- Render List --- //
+        struct RenderListEntry
+        {
+            IDisplayObject* obj = nullptr;
+            bool isExit = false;    // false: render the node, true: post-children work
+            bool isChild = false;   // false only for the active stage itself
+            bool visited = false;   // listeners already dispatched this frame
+            std::size_t exitIndex = 0;  // enter entries: index of the matching exit entry
+            // Enter entries only: what was drawn last frame (dirty-rect redraw)
+            bool drawnValid = false;
+            bool focusDrawn = false;
+            SDL_FRect drawn{};
+            // Enter entries only: area the node and its descendants can draw into this frame
+            SDL_FRect bounds{};
+        };
+        std::vector<RenderListEntry> renderList_;
+        IDisplayObject* renderListRoot_ = nullptr;
+        bool renderListDirty_ = true;
+        bool renderListUnsafe_ = false;
+        int renderListRebuilds_ = 0;
+        static constexpr int MAX_RENDER_RETRIES = 2;    // full passes rerun after mid-frame destruction
+        void rebuildRenderList_();
+        bool renderPass_(const SDL_FRect* clip);
+        bool renderRange_(std::size_t begin, std::size_t end, SDL_FRect visible, const SDL_FRect* clip);
+        void renderEntry_(RenderListEntry& entry);
+
+        // --- Culling and Child Clipping --- //
+        struct ClipFrame
+        {
+            std::size_t exitIndex = 0;  // exit entry of the clipping node
+            SDL_FRect restore{};        // visible area outside that node
+        };
+        std::vector<std::size_t> cullStack_;    // scratch for computeCullBounds_()
+        std::vector<ClipFrame> clipStack_;      // clipping ancestors of the current entry
+        void computeCullBounds_();
+
+        // --- Subtree Bitmap Caches --- //
+        struct SubtreeCache
+        {
+            TexturePool::Lease lease;       // own texture (not an atlas slot): blended premultiplied
+            int listVersion = -1;           // renderListRebuilds_ when rendered
+            std::uint64_t layout = 0;       // hash of descendant offsets and sizes
+        };
+        std::unordered_map<IDisplayObject*, SubtreeCache> subtreeCaches_;
+        bool renderingCache_ = false;       // drawing a subtree into its cache texture
+        bool renderCachedSubtree_(std::size_t enterIndex);   // false: no texture, draw live
+        void releaseSubtreeCaches_();
+
+        // --- Dirty-Rectangle Redraw --- //
+        static constexpr std::size_t MAX_DAMAGE_RECTS = 8;  // more are collapsed into their union
+        static constexpr float DAMAGE_MARGIN = 2.0f;        // covers outlines and drop shadows
+        bool dirtyRectRedraw_ = false;
+        float dirtyRectThreshold_ = 0.5f;
+        bool redrawAll_ = true;
+        SDL_Texture* damageTarget_ = nullptr;   // texture the damage history refers to
+        std::vector<SDL_FRect> damage_;
+        RedrawStats redrawStats_;
+        void collectDamage_();
+        bool mergeDamage_(float stageW, float stageH);
+
+        // --- Idle Mode --- //
+        static constexpr Uint32 FOCUS_FLASH_MS = 33;   // keeps the focus border animating
+        bool idleMode_ = false;
+        bool frameRequested_ = false;
+        Uint32 idleMaxWaitMs_ = 500;
+        Uint32 idleWakeEventType_ = 0;      // registered SDL user event used to interrupt a wait
+        Uint64 wakeupAt_ = 0;               // performance counter; 0 when none is scheduled
+        Uint64 idleSkippedFrames_ = 0;
+        Uint64 lastFrameTime_ = 0;          // performance counter at the last run() frame
+        bool wasIdle_ = false;              // last loop iteration skipped its frame
+        std::atomic_bool idleWaiting_{false};
+        Uint32 idleWaitMs_() const;
+
+        // --- Batched SDL dispatch --- //
+        bool sdlEventBatching_ = false;
+        std::vector<SDL_Event> sdlEventBatch_;
+        int sdlEventsPolled_ = 0;
+        int sdlEventsDispatched_ = 0;
+        int sdlEventsPolledLastFrame_ = 0;
+        int sdlEventsDispatchedLastFrame_ = 0;
+        void flushSDLEventBatch_();
+
+        // --- Sprite Batching --- //
+        SpriteBatch spriteBatch_;   // shared by SpriteSheet, BitmapFont and the glyph atlas
+        RenderCommandBuffer renderCommands_;    // deferred stage-pass draws, submitted per frame
+        TexturePool texturePool_;   // render targets leased by cached-texture widgets
+
         // --- Tab Priority --- //
         struct TabPriorityComparator {
             bool operator()(const DisplayHandle& a, const DisplayHandle& b) const {
@@ -468,6 +669,13 @@ namespace SDOM
         // Called on main thread to apply any pending config request.
         void applyPendingConfig();
 
+    private:
+        // Cross-thread post target, reached only through PostGuard. Published
+        // once the EventManager exists and withdrawn before it is destroyed;
+        // posters count themselves in so teardown can wait for them to leave.
+        inline static std::atomic<EventManager*> postTarget_{nullptr};
+        inline static std::atomic<int> postsInFlight_{0};
+
     protected:
         friend Factory;
 
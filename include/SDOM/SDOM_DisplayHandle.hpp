@@ -21,7 +21,14 @@
  * - DisplayHandles are **non-owning**.
  * - Actual object deletion occurs only through Core or Factory teardown routines.
  * - When an object is removed, any existing DisplayHandles resolve to `nullptr`.
+ * - Handles minted by the Factory pin one object through its generational slot id;
+ *   once that object is destroyed they stay null even if the name is reused.
+ * - Handles built from a name follow the name: if the cached slot id goes stale,
+ *   `get()` looks the name up again and picks up a newer object of that name.
  * - Lost handles can always be recovered by name until the object is explicitly destroyed or garbage-collected.
+ * - Handles still carry the object name as a `std::string` (name-built handles
+ *   need it to resolve). Names up to the library's small-string size copy
+ *   without allocating; longer names allocate on copy. The type is an Atom.
  *
  * ---
  * ### 🪄 Example
@@ -45,6 +52,7 @@
 // #include <sstream>
 // #include <SDOM/SDOM.hpp>
 #include <SDOM/SDOM_IDataObject.hpp>
+#include <SDOM/SDOM_Atom.hpp>
 #include <cstdint>
 
 // NOTE: this ~= "DisplayHandle(getName(), getType())"
@@ -64,8 +72,10 @@ namespace SDOM
         DisplayHandle();
         DisplayHandle(const std::string& name, const std::string& type, uint64_t id = 0)
             : name_(name), type_(type), id_(id) {}
+        DisplayHandle(const std::string& name, Atom type, uint64_t id = 0)
+            : name_(name), type_(type), id_(id) {}
         DisplayHandle(const DisplayHandle& other)
-            : name_(other.name_), type_(other.type_), id_(other.id_) {}
+            : name_(other.name_), type_(other.type_), id_(other.id_), byName_(other.byName_) {}
 
         // Provide explicit copy-assignment to avoid implicitly-declared
         // deprecated assignment operator warnings when a user-provided
@@ -75,6 +85,7 @@ namespace SDOM
                 name_ = other.name_;
                 type_ = other.type_;
                 id_   = other.id_;
+                byName_ = other.byName_;
             }
             return *this;
         }
@@ -83,8 +94,9 @@ namespace SDOM
         DisplayHandle& operator=(DisplayHandle&& other) noexcept {
             if (this != &other) {
                 name_ = std::move(other.name_);
-                type_ = std::move(other.type_);
+                type_ = other.type_;
                 id_   = other.id_;
+                byName_ = other.byName_;
             }
             return *this;
         }
@@ -118,8 +130,8 @@ namespace SDOM
         // Comparison operators
         bool operator==(std::nullptr_t) const { return get() == nullptr; }
         bool operator!=(std::nullptr_t) const { return get() != nullptr; }
-        // bool operator==(const DisplayHandle& other) const { return name_ == other.name_ && type_ == other.type_; }
-        bool operator==(const DisplayHandle& other) const { return name_ == other.name_; }
+        // Handles compare by slot id; name-only handles resolve their id first.
+        bool operator==(const DisplayHandle& other) const;
         bool operator!=(const DisplayHandle& other) const { return !(*this == other); }
         // }
 
@@ -129,14 +141,16 @@ namespace SDOM
             // ptr_ = nullptr;
             name_.clear();
             id_ = 0;
+            byName_ = false;
             // ...other members...
         }
         std::string getName() const { return name_; }
-        std::string getType() const { return type_; }
+        const std::string& getType() const { return type_.str(); }
+        Atom getTypeAtom() const { return type_; }
         void setName(const std::string& newName) { name_ = newName; }
-        void setType(const std::string& newType) { type_ = newType; }
+        void setType(const std::string& newType) { type_ = Atom(newType); }
         uint64_t getId() const { return id_; }
-        void setId(uint64_t newId) { id_ = newId; }
+        void setId(uint64_t newId) { id_ = newId; byName_ = false; }
 
         std::string str() const {
             std::ostringstream oss;
@@ -162,11 +176,15 @@ namespace SDOM
         friend Factory;
 
         std::string name_;
-        std::string type_;
+        Atom type_;         // interned: handle copies do not copy the type name
         uint64_t id_ = 0;
+        bool byName_ = false;   // id_ was looked up from name_; re-resolve by name when stale
 
         mutable std::string formatted_; // to keep the formatted string alive for c_str()
 
+        // Name-only handles (id 0) pick up their slot id lazily and become byName_
+        void resolveId_() const;
+
         
     protected:
         
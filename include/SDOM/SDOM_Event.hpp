@@ -69,6 +69,25 @@ namespace SDOM
 
         virtual ~Event() = default;    
 
+        // ----------------------
+        // Event Pool
+        // ----------------------
+        // Event storage is recycled through a free list, so the steady-state frame
+        // loop does not touch the global heap. std::make_unique<Event> and
+        // std::unique_ptr<Event> use the pool transparently.
+        static void* operator new(std::size_t size);
+        static void operator delete(void* ptr, std::size_t size) noexcept;
+
+        struct PoolStats 
+        {
+            uint64_t heapAllocations = 0;   // blocks obtained from the global heap
+            uint64_t poolReuses = 0;        // allocations served from the free list
+            uint64_t live = 0;              // Events currently alive on the heap
+            std::size_t freeBlocks = 0;     // blocks cached for reuse by the calling thread
+        };
+        static PoolStats getPoolStats();
+        static void trimPool();             // release the calling thread's cached blocks
+
 
         // ----------------------
         // virtual methods
@@ -84,6 +103,7 @@ namespace SDOM
 
         EventType getType() const; // ✅
         std::string getTypeName() const; // ✅
+        EventType::IdType getTypeId() const; // numeric EventType id (no EventType copy)
 
         std::string getPhaseString() const; // ✅
 
@@ -149,6 +169,34 @@ namespace SDOM
         }
 
 
+        // ----------------------
+        // Typed Input Payload
+        // ----------------------
+        // Built-in mouse/keyboard fields live in this fixed POD struct rather than
+        // in the JSON payload, so setting them never materializes JSON and they
+        // copy as plain memory. The JSON payload remains for custom, user-defined
+        // data. This does not make an Event allocation-free: copying one still
+        // copies the target handles' name strings (heap-backed for names past the
+        // small-string buffer) and the EventType's doc string.
+        struct InputPayload 
+        {
+            float mouseX = 0.0f;
+            float mouseY = 0.0f;
+            float wheelX = 0.0f;
+            float wheelY = 0.0f;
+            float dragOffsetX = 0.0f;
+            float dragOffsetY = 0.0f;
+            int clickCount = 0;
+            uint8_t button = 0;
+            SDL_Scancode scancode = SDL_SCANCODE_UNKNOWN;
+            SDL_Keycode keycode = SDLK_UNKNOWN;
+            Uint16 keymod = 0;
+            int asciiCode = 0;
+        };
+
+        InputPayload getInputPayload() const;
+        Event& setInputPayload(const InputPayload& input);
+
         // ----------------------
         // Mouse Event Accessors
         // ----------------------
@@ -205,7 +253,8 @@ namespace SDOM
         mutable bool use_capture = false;               // Indicates if the event is in the capture phase
         float elapsed_time = 0.0f;                      // Time elapsed since the last frame
 
-        nlohmann::json payload_;   // JSON payload for event-specific data (single source of truth)
+        InputPayload input_;       // built-in mouse/keyboard fields (POD, copied as plain memory)
+        nlohmann::json payload_;   // optional JSON payload for custom data (null until first use)
         mutable std::mutex event_mutex_;
 
     public:
@@ -221,6 +270,7 @@ namespace SDOM
             disable_default_behavior(other.disable_default_behavior),
             use_capture(other.use_capture),
             elapsed_time(other.elapsed_time),
+            input_(other.input_),
             payload_(other.payload_) {
             // Note: `eventMutex_` is initialized as a new mutex
         }
@@ -239,6 +289,7 @@ namespace SDOM
                 disable_default_behavior = other.disable_default_behavior;
                 use_capture = other.use_capture;
                 elapsed_time = other.elapsed_time;
+                input_ = other.input_;
                 payload_ = other.payload_;
             }
             return *this;
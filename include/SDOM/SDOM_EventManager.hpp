@@ -41,11 +41,15 @@
 
 #include <SDOM/SDOM.hpp>
 
+#include <atomic>
 #include <memory>
 #include <queue>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
+#include <SDOM/SDOM_EventTypeHash.hpp>
+#include <SDOM/SDOM_MPSCQueue.hpp>
 // #include "SDOM/SDOM_Event.hpp"
 // #include "SDOM/SDOM_IDisplayObject.hpp"
 
@@ -60,7 +64,7 @@ namespace SDOM
     {
     public:
         EventManager() = default;
-        ~EventManager() = default;
+        ~EventManager();
 
         // ========================================================================
         // 🧱 Core API
@@ -72,6 +76,13 @@ namespace SDOM
         // Queue an SDL_Event as an SDOM::Event
         void Queue_SDL_Event(SDL_Event& sdlEvent);
 
+        // --- Batched SDL dispatch helpers (see Core::setSDLEventBatching) --- //
+        // EventType whose batch/coalesce policy governs a raw SDL event type, or nullptr
+        static const EventType* eventTypeForSDL(Uint32 sdlType);
+        // Append `sdlEvent` to a frame batch, merging it into the previous entry when
+        // both share a type whose BatchPolicy is Coalesce. Returns true if merged.
+        static bool batchSDL_Event(std::vector<SDL_Event>& batch, const SDL_Event& sdlEvent);
+
         // Dispatch all queued events
         void DispatchQueuedEvents();
 
@@ -88,10 +99,46 @@ namespace SDOM
         // Retrieve (without dispatching) the next queued event, if any.
         std::unique_ptr<Event> takeNextEvent();
 
-        // Returns true if there are any listeners (or node-default handlers)
-        // registered that would receive events of the given type on the current stage.
+        // ------------------------------------------------------------------------
+        // 🧵 Cross-Thread Posting
+        // ------------------------------------------------------------------------
+        // Lock-free entry points for producers outside the main loop (network,
+        // simulation or foreign-language worker threads). Posted events land in a
+        // bounded MPSC ring and are moved into the regular queue at the start of
+        // DispatchQueuedEvents(). When the ring is full the post is rejected and
+        // counted; the caller owns any retry/back-off policy.
+        static constexpr std::size_t POST_QUEUE_CAPACITY = 4096;
+
+        // Post a fully built event. Returns false (event discarded) if the queue is full.
+        bool postEvent(std::unique_ptr<Event> event);
+        // Post by numeric EventType id and display object id; the Event itself is
+        // built on the main thread. targetId 0 targets the stage. payloadJson is copied.
+        bool postEvent(uint32_t typeId, uint64_t targetId, const char* payloadJson = nullptr);
+
+        struct PostQueueStats
+        {
+            uint64_t posted = 0;        // accepted posts
+            uint64_t rejected = 0;      // posts refused because the ring was full
+            uint64_t drained = 0;       // posts moved into the main queue
+            std::size_t highWater = 0;  // largest backlog seen by a single drain
+            std::size_t capacity = 0;
+        };
+        PostQueueStats getPostQueueStats() const;
+
+        // Returns true if any display object has a listener registered for the
+        // given type. O(1): answered from the listener subscription index.
         bool hasListeners(const EventType& type) const;
 
+        // --- Listener Subscription Index --- //
+        // Maintained by IDisplayObject::addEventListener/removeEventListener and
+        // object destruction so global queries only touch actual subscribers.
+        void addListenerSubscription(const EventType& type, IDisplayObject* obj, int count = 1);
+        void removeListenerSubscription(const EventType& type, IDisplayObject* obj, int count);
+        // Track/untrack an object for hover heuristics and listener bookkeeping.
+        // Tracking re-evaluates the object's type, so call it again after setType().
+        void trackDisplayObject(IDisplayObject* obj);
+        void forgetDisplayObject(IDisplayObject* obj);
+
         // Utility methods
         bool isMouseWithinBounds(IDisplayObject& target) const;
         DisplayHandle findTopObjectUnderMouse(DisplayHandle rootNode, DisplayHandle excludeNode = DisplayHandle()) const;
@@ -107,6 +154,9 @@ namespace SDOM
         // Returns the number of events currently queued.
         int getEventQueueSize() const { return static_cast<int>(eventQueue.size()); }
 
+        // True if events are queued or cross-thread posts are waiting to be drained.
+        bool hasPendingEvents() const { return !eventQueue.empty() || postQueue_.sizeApprox() > 0; }
+
         // Retrieves (non-destructively) a snapshot of all currently queued events.
         // Note: This method temporarily rotates the internal queue to gather
         // pointers, preserving order and restoring the queue to its original state.
@@ -126,6 +176,24 @@ namespace SDOM
         // Per-frame tick: maintains hover watchdog for reliable MouseLeave
         void onFrameTick();
 
+        // --- Event Pool Metrics --- //
+        // Sampled at each onFrameTick(); values describe the last complete frame.
+        // In steady state heap allocations should stay at zero (pool reuse only).
+        uint64_t getEventHeapAllocationsLastFrame() const { return eventHeapAllocsLastFrame_; }
+        uint64_t getEventsCreatedLastFrame() const { return eventsCreatedLastFrame_; }
+
+        // ------------------------------------------------------------------------
+        // 🗺️ Hit-Test Spatial Index
+        // ------------------------------------------------------------------------
+        // Uniform grid over the world rects of the stage being hit-tested. It is
+        // rebuilt when the hierarchy or sibling order changes; nodes whose world
+        // bounds change are re-binned one by one before the next query. Hidden,
+        // clickable and z-order state is read live from the objects at query time.
+        void setHitTestIndexEnabled(bool enabled) { hitIndexEnabled_ = enabled; invalidateHitTestIndex(); }
+        bool isHitTestIndexEnabled() const { return hitIndexEnabled_; }
+        void invalidateHitTestIndex() { hitIndexDirty_ = true; }
+        void markHitBoundsDirty(IDisplayObject* obj);
+
     private:
 
         // ========================================================================
@@ -145,11 +213,84 @@ namespace SDOM
         Uint32 coalesce_last_flush_ms_ = 0;
         void flushCoalesced_();
 
+        // --- Listener subscription index --- //
+        // EventType -> (subscribing object -> number of registered listeners).
+        // Slab pools reuse addresses, so each entry also carries a generation
+        // taken when it was created; a snapshot only calls an object whose
+        // entry still has the generation it saw.
+        struct ListenerSubscription
+        {
+            int count = 0;
+            uint64_t generation = 0;
+        };
+        std::unordered_map<EventType, std::unordered_map<IDisplayObject*, ListenerSubscription>, EventTypeHash> listenerIndex_;
+        uint64_t listenerGeneration_ = 0;
+        // Live objects whose type relies on default hover handling; hidden and
+        // disabled ones are skipped when should_emit_hover_events() asks
+        std::unordered_set<IDisplayObject*> hoverCandidates_;
+
+        // --- Cross-thread posting --- //
+        struct PostedEvent
+        {
+            Event* event = nullptr;     // C++ producers: fully built event (owned)
+            uint32_t typeId = 0;        // id-based producers: built while draining
+            uint64_t targetId = 0;
+            char* payloadJson = nullptr; // owned copy (new[]), may be null
+        };
+        MPSCQueue<PostedEvent> postQueue_{ POST_QUEUE_CAPACITY };
+        std::atomic<uint64_t> postAccepted_{0};
+        std::atomic<uint64_t> postRejected_{0};
+        std::atomic<uint64_t> postDrained_{0};
+        std::atomic<std::size_t> postHighWater_{0};
+        void drainPostedEvents_();
+        static void releasePosted_(PostedEvent& posted);
+
+        // Event pool counters (see Event::getPoolStats())
+        uint64_t eventHeapAllocsLastFrame_ = 0;
+        uint64_t eventsCreatedLastFrame_ = 0;
+        uint64_t eventHeapAllocsMark_ = 0;
+        uint64_t eventsCreatedMark_ = 0;
+
         // Hover watchdog: force a MouseLeave if no motion processed
         // for a number of frames while an object is hovered.
         int hover_idle_frames_ = 0;
         DisplayHandle hover_watch_target_ = nullptr;
 
+        // --- Hit-test spatial index --- //
+        struct HitEntry
+        {
+            IDisplayObject* obj = nullptr;
+            DisplayHandle handle;
+            int parent = -1;        // entry index of the parent (-1 for the root)
+            int depth = 0;
+            int seq = 0;            // pre-order position; doubles as the tie-break sequence
+            int seqEnd = 0;         // last pre-order position inside this subtree
+            SDL_Rect rect{ 0, 0, 0, 0 };
+            int cellX0 = 0, cellY0 = 0, cellX1 = -1, cellY1 = -1;  // binned cell range
+            bool oversized = false; // spans too many cells; tested on every query
+        };
+        static constexpr int HIT_GRID_CELL_SIZE = 64;
+        static constexpr int HIT_GRID_MAX_CELLS_PER_ENTRY = 64;
+        bool hitIndexEnabled_ = true;
+        mutable bool hitIndexDirty_ = true;
+        mutable const IDisplayObject* hitIndexRoot_ = nullptr;
+        mutable std::vector<HitEntry> hitEntries_;
+        mutable std::unordered_map<const IDisplayObject*, int> hitEntryOf_;
+        mutable std::vector<std::vector<int>> hitGridCells_;
+        mutable std::vector<int> hitOversized_;
+        mutable std::vector<IDisplayObject*> hitBoundsDirty_;
+        mutable int hitGridCols_ = 0;
+        mutable int hitGridRows_ = 0;
+        mutable int hitGridOriginX_ = 0;
+        mutable int hitGridOriginY_ = 0;
+
+        void refreshHitIndex_(IDisplayObject* root) const;
+        void rebuildHitIndex_(IDisplayObject* root) const;
+        void binHitEntry_(int index) const;
+        void unbinHitEntry_(int index) const;
+        DisplayHandle queryHitIndex_(IDisplayObject* root, int px, int py, const DisplayHandle& excludeNode, 
+                                     bool clickableOnly, bool pruneHidden) const;
+
 
         // ========================================================================
         // 🧩 Internal SDL Event Handling Helpers
@@ -65,6 +65,7 @@
 #include <unordered_map>
 #include <atomic>
 #include <cstdint>
+#include <SDOM/SDOM_Atom.hpp>
 
 
 // Allow optional Lua bindings: forward-declare `sol::state_view` so callers
@@ -184,7 +185,7 @@ namespace SDOM
         static EventType User;              // 
                
         explicit EventType(const std::string& name, const std::string& doc = std::string())
-            : name(name), doc_(doc), category_("Uncategorized"), captures_(true), bubbles_(true), targetOnly_(false), global_(false)
+            : name(name), doc_(doc), category_(std::string_view("Uncategorized")), captures_(true), bubbles_(true), targetOnly_(false), global_(false)
         { registerEventType(name, this); getOrAssignId(); }
 
         // New overload that accepts an explicit category string
@@ -193,7 +194,7 @@ namespace SDOM
         { registerEventType(name, this); getOrAssignId(); }
 
         explicit EventType(const std::string& name, bool captures, bool bubbles, bool targetOnly, bool global, const std::string& doc = std::string()) 
-            : name(name), doc_(doc), category_("Uncategorized"), captures_(captures), bubbles_(bubbles), targetOnly_(targetOnly), global_(global) 
+            : name(name), doc_(doc), category_(std::string_view("Uncategorized")), captures_(captures), bubbles_(bubbles), targetOnly_(targetOnly), global_(global) 
         { 
             registerEventType(name, this); 
             getOrAssignId();
@@ -207,11 +208,17 @@ namespace SDOM
             getOrAssignId();
         }
 
-        const std::string& getName() const { return name; }
+        const std::string& getName() const { return name.str(); }
+        Atom getNameAtom() const { return name; }
 
-        bool operator==(const EventType& other) const { return name == other.name; }
-        bool operator!=(const EventType& other) const { return name != other.name; }
-        bool operator<(const EventType& other) const { return name < other.name; }
+        // Every constructed EventType carries a numeric id shared by all instances
+        // of the same name, so equality is an integer compare (name as fallback).
+        bool operator==(const EventType& other) const 
+        { 
+            return (id_ != 0 && other.id_ != 0) ? id_ == other.id_ : name == other.name; 
+        }
+        bool operator!=(const EventType& other) const { return !(*this == other); }
+        bool operator<(const EventType& other) const { return name.str() < other.name.str(); }
 
         static void registerEventType(const std::string& name, EventType* ptr) {
             if (registry.find(name) == registry.end()) {
@@ -241,6 +248,12 @@ namespace SDOM
         enum class CoalesceKey { Global, ByTarget };
         CoalesceStrategy getCoalesceStrategy() const;
         CoalesceKey getCoalesceKey() const;
+        // Batched SDL dispatch (Core::setSDLEventBatching): latency vs. fidelity
+        //   Fidelity:  keep every event, in order (default)
+        //   Coalesce:  merge consecutive events of this type using the coalesce strategy
+        //   Immediate: flush the pending batch and dispatch this event right away
+        enum class BatchPolicy { Fidelity, Coalesce, Immediate };
+        BatchPolicy getBatchPolicy() const;
 
         // -- Setters -- //
         EventType& setCaptures(bool captures);
@@ -254,6 +267,7 @@ namespace SDOM
         EventType& setMeterIntervalMs(uint16_t ms);
         EventType& setCoalesceStrategy(CoalesceStrategy s);
         EventType& setCoalesceKey(CoalesceKey k);
+        EventType& setBatchPolicy(BatchPolicy p);
 
         // -- Public Lua support -- //   
                 
@@ -266,19 +280,20 @@ namespace SDOM
         // Numeric id support for C API interop
         using IdType = uint32_t;
         IdType getOrAssignId();
+        IdType getId() const { return id_; }   // 0 if no id has been assigned yet
         void setId(IdType id);
         static EventType* fromId(IdType id);
         // Optional documentation string for this EventType (used by generators)
         std::string getDoc() const;
         void setDoc(const std::string& s);
         // Optional category string used by generators to group related EventTypes
-        std::string getCategory() const { return category_; }
-        void setCategory(const std::string& c) { category_ = c; }
+        const std::string& getCategory() const { return category_.str(); }
+        void setCategory(const std::string& c) { category_ = Atom(c); }
 
     private:
-        std::string name;
+        Atom name;         // interned: EventType is copied by value with every Event::getType()
         std::string doc_;
-        std::string category_ = "Uncategorized";
+        Atom category_{std::string_view("Uncategorized")};
         static inline std::unordered_map<std::string, EventType*> registry;
         static inline std::vector<EventType*> registry_order; // preserves insertion/definition order
 
@@ -298,6 +313,7 @@ namespace SDOM
         uint16_t meter_interval_ms_ = 0; // 0 => use SDOM_EVENT_METER_MS_DEFAULT
         CoalesceStrategy coalesce_strategy_ = CoalesceStrategy::None;
         CoalesceKey coalesce_key_ = CoalesceKey::Global;
+        BatchPolicy batch_policy_ = BatchPolicy::Fidelity;
 
     };
 
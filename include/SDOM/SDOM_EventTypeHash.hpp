@@ -7,9 +7,9 @@
  *  
  * The SDOM_EventTypeHash struct provides a custom hash functor for the EventType class, 
  * enabling efficient use of EventType objects as keys in unordered associative containers such 
- * as std::unordered_map and std::unordered_set. By hashing the event type’s name, this functor 
- * ensures that event types can be quickly and uniquely identified within hash-based data 
- * structures. This is essential for fast event lookup, registration, and dispatching within 
+ * as std::unordered_map and std::unordered_set. By hashing the event type’s numeric id 
+ * (falling back to its name), this functor ensures that event types can be quickly and 
+ * uniquely identified within hash-based data structures. This is essential for fast event lookup, registration, and dispatching within 
  * the SDOM event system, supporting scalable and performant event-driven programming.
  * 
  * 
@@ -52,7 +52,10 @@ namespace SDOM {
     // Custom hash functor for SDOM::EventType to be used in unordered containers
     struct EventTypeHash {
         std::size_t operator()(const EventType& eventType) const noexcept {
-            return std::hash<std::string>()(eventType.getName());
+            // Hash the numeric id when assigned; avoids hashing the name string
+            if (eventType.getId() != 0)
+                return std::hash<EventType::IdType>()(eventType.getId());
+            return std::hash<Atom>()(eventType.getNameAtom());
         }
     };
 
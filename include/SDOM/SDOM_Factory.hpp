@@ -11,9 +11,12 @@
 #include <chrono>
 #include <unordered_map>
 #include <vector>
+#include <array>
 #include <atomic>
+#include <mutex>
 #include <shared_mutex>
 #include <cstdint>
+#include <span>
 // #include <external/nlohmann/json.hpp>
 #include <json.hpp>
 
@@ -22,6 +25,7 @@
 #include <SDOM/SDOM_IDisplayObject.hpp>   // required for std::unique_ptr<IDisplayObject>
 #include <SDOM/SDOM_IAssetObject.hpp>     // required for std::unique_ptr<IAssetObject>
 #include <SDOM/SDOM_DataRegistry.hpp>
+#include <SDOM/SDOM_SlabPool.hpp>
  
 
 namespace SDOM 
@@ -37,11 +41,23 @@ namespace SDOM
     {
         using InitFn = std::function<std::unique_ptr<IDisplayObject>(const IDisplayObject::InitStruct&)>;
         using JsonFn = std::function<std::unique_ptr<IDisplayObject>(const nlohmann::json&)>;
+        using ParseFn = std::function<std::shared_ptr<IDisplayObject::InitStruct>(const nlohmann::json&)>;
 
         InitFn fromInitStruct;
         JsonFn fromJson;
+        std::size_t objectSize = 0;     // sizeof the concrete type; enables per-type pool reserve/stats
+        ParseFn parseJson;              // JSON -> concrete InitStruct; enables display templates
     };
 
+    // ParseFn for types following the T::InitStruct::from_json(j, init) convention
+    template<class T>
+    std::shared_ptr<IDisplayObject::InitStruct> ParseInitStruct(const nlohmann::json& j)
+    {
+        auto init = std::make_shared<typename T::InitStruct>();
+        T::InitStruct::from_json(j, *init);
+        return init;
+    }
+
     struct AssetTypeCreators 
     {
         using InitFn = std::function<std::unique_ptr<IAssetObject>(const IAssetObject::InitStruct&)>;
@@ -57,11 +73,13 @@ namespace SDOM
     struct DisplayRecord
     {
         std::unique_ptr<IDisplayObject> obj;
-        std::string type;
+        Atom type;
         uint64_t id = 0;
 
         DisplayRecord(std::unique_ptr<IDisplayObject> o = nullptr, const std::string& t = "", uint64_t i = 0)
             : obj(std::move(o)), type(t), id(i) {}
+        DisplayRecord(std::unique_ptr<IDisplayObject> o, Atom t, uint64_t i = 0)
+            : obj(std::move(o)), type(t), id(i) {}
     };
 
     // Wrap an asset object (shared ownership allowed) plus metadata
@@ -78,6 +96,7 @@ namespace SDOM
     class Factory final
     {
         friend class Core;  // Core should have direct access to the Factory internals
+        friend class IDisplayObject;    // reports parent changes for orphan tracking
 
     public:
         // --- Lifecycle --- //
@@ -105,9 +124,62 @@ namespace SDOM
         DisplayHandle createDisplayObject(const std::string& typeName, const IDisplayObject::InitStruct& init);
         DisplayHandle createDisplayObjectFromJson(const std::string& typeName, const nlohmann::json&);
 
+        // --- Bulk Creation --- //
+        // Build many objects in one pass: creators are resolved once per run of
+        // the same type, the registry is grown once, and every id is issued
+        // under a single slot-map lock. Results line up with the input; failed
+        // entries are invalid handles. Names are checked before anything is
+        // registered: an empty name throws, and an existing or repeated name
+        // aliases the registered (or first) object like the single-object call
+        // (InitStruct path) or throws (JSON path, read "type"). A throw leaves
+        // the registry untouched. Each init's `type` must match its concrete
+        // InitStruct.
+        //
+        // The JSON path may be given each node's parent index (-1 for none,
+        // otherwise earlier in `nodes`); nodes under one that failed to build
+        // are skipped instead of being created.
+        std::vector<DisplayHandle> createDisplayObjects(std::span<const IDisplayObject::InitStruct* const> inits);
+        template<class Init>
+        std::vector<DisplayHandle> createDisplayObjects(std::span<const Init> inits)
+        {
+            std::vector<const IDisplayObject::InitStruct*> ptrs;
+            ptrs.reserve(inits.size());
+            for (const Init& init : inits) ptrs.push_back(&init);
+            return createDisplayObjects(std::span<const IDisplayObject::InitStruct* const>(ptrs));
+        }
+        std::vector<DisplayHandle> createDisplayObjectsFromJson(std::span<const nlohmann::json* const> nodes,
+                                                                std::span<const int> parents = {});
+
+        // Capacity hint: room for `count` more display objects in the registry
+        // and id slot map, so a large load does not rehash or add pages midway
+        void reserveRegistry(std::size_t count);
+
+        // --- Display Templates --- //
+        // A template is a JSON subtree compiled once into the concrete
+        // InitStructs of its nodes. Instantiating it constructs straight from
+        // those structs through the bulk creation path: no JSON is read again.
+        // Every node type must have been registered with a parseJson creator.
+        // Instance roots are named `instanceName` (or `<template>_<n>` when
+        // empty); descendants are `<root>.<node name>`. Returns invalid handles
+        // if any of those names is already taken.
+        bool registerDisplayTemplate(const std::string& name, const nlohmann::json& subtree);
+        void unregisterDisplayTemplate(const std::string& name);
+        bool hasDisplayTemplate(const std::string& name) const;
+        std::size_t getDisplayTemplateSize(const std::string& name) const;     // nodes per instance
+        DisplayHandle instantiateDisplayTemplate(const std::string& name, const std::string& instanceName = "");
+        std::vector<DisplayHandle> instantiateDisplayTemplates(const std::string& name, std::size_t count);
+
         AssetHandle createAssetObject(const std::string& typeName, const IAssetObject::InitStruct& init);
         AssetHandle createAssetObjectFromJson(const std::string& typeName, const nlohmann::json&);
 
+        // --- Pooled Storage --- //
+        // Display objects live in per-type slabs (see SDOM_SlabPool.hpp). Reserve
+        // ahead of a known burst of one type so it needs no slab growth mid-frame.
+        // Both require the type to have been registered with an objectSize.
+        bool reserveDisplayObjects(const std::string& typeName, std::size_t count);
+        SlabPool::Stats getDisplayObjectPoolStats(const std::string& typeName) const;
+        SlabPool::Stats getDisplayObjectPoolStats() const;  // all types
+
         // --- Object Lookup --- //
         // Preferred modern names: return raw interface pointers for callers
         IDisplayObject* getDisplayObjectPtr(const std::string& name);
@@ -119,6 +191,10 @@ namespace SDOM
         // Stable-id resolution helpers (public so ABI marshaling can resolve handles)
         DisplayHandle resolveDisplayHandleById(uint64_t id) const;
         AssetHandle resolveAssetHandleById(uint64_t id) const;
+        // Lock-free O(1) slot lookup; returns nullptr for stale or unknown ids
+        IDisplayObject* resolveDisplayObjectPtr(uint64_t id) const;
+        // Returns the current slot id for a named display object (0 if unknown)
+        uint64_t getDisplayObjectId(const std::string& name) const;
 
         // --- Display Object Management --- //
 
@@ -128,11 +204,17 @@ namespace SDOM
         void destroyAssetObject(const std::string& name);
 
         // --- Orphan Management --- //
+        // Orphans (parentless, non-Stage display objects) are tracked as
+        // parents change, so none of these scan the registry. collectGarbage()
+        // destroys due orphans in deadline order and stops once the per-frame
+        // budget is spent; the rest wait for the next frame.
         int countOrphanedDisplayObjects() const;
         std::vector<DisplayHandle> getOrphanedDisplayObjects();
         void destroyOrphanedDisplayObjects();
         void detachOrphans();   // Detach all orphans in the orphan list from their parents.
         void collectGarbage();  // Maintenance orphaned objects based on their retention policy
+        void setGarbageBudget(std::chrono::microseconds budget) { gcBudget_ = budget; }
+        std::chrono::microseconds getGarbageBudget() const { return gcBudget_; }
 
 
         // --- Future Child Management --- //
@@ -225,7 +307,9 @@ namespace SDOM
         // Use shared_ptr inside AssetRecord so multiple registry names can alias the same underlying asset
         std::unordered_map<std::string, std::unique_ptr<AssetRecord>> assetObjects_;
 
-        std::unordered_map<std::string, TypeCreators> creators_;            // are these now needed?
+        // Keyed by the interned type name: objects built through an entry take
+        // its key as their type, so creation interns nothing per object.
+        std::unordered_map<Atom, TypeCreators> creators_;
         std::unordered_map<std::string, AssetTypeCreators> assetCreators_;  // are these now needed?
 
         // --- Performance Tracking Maps --- //
@@ -246,16 +330,89 @@ namespace SDOM
         };            
         std::vector<futureChild> futureChildrenList_;
 
+        // --- Orphan Tracking --- //
+        // orphans_ maps each current orphan to the ticket issued when it lost
+        // its parent. orphanQueue_ is a min-heap on the destruction deadline;
+        // entries whose ticket no longer matches (adopted, re-orphaned or
+        // destroyed since) are dropped when they reach the top.
+        struct OrphanEntry
+        {
+            std::chrono::steady_clock::time_point due;
+            uint64_t ticket = 0;
+            IDisplayObject* obj = nullptr;
+            bool operator>(const OrphanEntry& o) const { return due > o.due; }
+        };
+        std::unordered_map<IDisplayObject*, uint64_t> orphans_;
+        std::vector<OrphanEntry> orphanQueue_;
+        uint64_t nextOrphanTicket_ = 1;
+        std::chrono::microseconds gcBudget_{GC_FRAME_BUDGET};
+
+        void noteOrphaned_(IDisplayObject* obj);    // obj has no parent now
+        void noteAdopted_(IDisplayObject* obj);     // obj has a parent again
+        void requeueOrphan_(IDisplayObject* obj);   // obj's retention policy or grace changed
+        void pushOrphan_(IDisplayObject* obj, uint64_t ticket);
+
+        // Creator lookup by type text; Atom::find() never interns unknown names
+        std::unordered_map<Atom, TypeCreators>::const_iterator findCreators_(std::string_view typeName) const
+        {
+            return creators_.find(Atom::find(typeName));
+        }
+
+        // Bulk creation: insert, start up, register and announce built objects
+        void commitDisplayObjects_(std::vector<std::unique_ptr<IDisplayObject>>& built,
+                                   std::vector<DisplayHandle>& out, bool aliasDuplicates);
+
+        // --- Display Templates --- //
+        struct DisplayTemplate
+        {
+            struct Node
+            {
+                Atom type;
+                std::string localName;      // unique within the template
+                std::shared_ptr<IDisplayObject::InitStruct> init;  // name is overwritten per instance
+                TypeCreators::InitFn create;    // captured at compile time
+                int parent = -1;
+                std::vector<int> children;
+            };
+            std::vector<Node> nodes;        // preorder; nodes[0] is the root
+        };
+        std::unordered_map<std::string, DisplayTemplate> displayTemplates_;
+        uint64_t nextTemplateInstance_ = 1;
+
+        bool compileTemplateNode_(const nlohmann::json& node, int parent, DisplayTemplate& tpl);
+        bool templateNamesFree_(const DisplayTemplate& tpl, const std::string& root) const;
+        std::vector<DisplayHandle> instantiate_(DisplayTemplate& tpl, const std::vector<std::string>& roots);
+        void attachTemplateNode_(const DisplayTemplate& tpl, DisplayHandle* handles, int index);
+
         // --- ID Registry --- //
         // Atomic counter for issuing stable 64-bit ids (0 reserved)
         std::atomic<uint64_t> next_object_id_{1};
-        // Map stable id -> handle (separate maps for display and asset handles). Protected by a shared_mutex for concurrent reads.
-        std::unordered_map<uint64_t, DisplayHandle> display_id_map_;
+        // Map stable id -> handle for assets. Protected by a shared_mutex for concurrent reads.
         std::unordered_map<uint64_t, AssetHandle> asset_id_map_;
         mutable std::shared_mutex id_map_mutex_;
 
+        // --- Display Object Slot Map --- //
+        // Display ids pack (generation << 32 | slot index). Slots live in fixed
+        // pages that are never moved or freed while the Factory is alive, so
+        // readers resolve ids with atomic loads only. Destroying an object bumps
+        // its slot generation, which turns every outstanding id into a miss.
+        struct DisplaySlot
+        {
+            std::atomic<IDisplayObject*> obj{nullptr};
+            std::atomic<uint32_t> generation{1};
+        };
+        static constexpr uint32_t DISPLAY_SLOT_PAGE_SIZE = 1024;
+        static constexpr uint32_t DISPLAY_SLOT_MAX_PAGES = 4096;
+        std::array<std::atomic<DisplaySlot*>, DISPLAY_SLOT_MAX_PAGES> displaySlotPages_{};
+        std::vector<std::unique_ptr<DisplaySlot[]>> displaySlotStorage_;   // owns the pages
+        std::vector<uint32_t> freeDisplaySlots_;
+        uint32_t displaySlotCount_ = 0;
+        std::mutex displaySlotMutex_;   // serializes writers only
+
         // ID registry helpers (private)
         uint64_t registerDisplayObject(const std::string& name, DisplayHandle handle);
+        uint64_t acquireDisplaySlot_(IDisplayObject* obj);     // caller holds displaySlotMutex_
+        void addDisplaySlotPage_(uint32_t page);               // caller holds displaySlotMutex_
         DisplayHandle resolveDisplayObject(uint64_t id) const;
         void unregisterDisplayObject(uint64_t id);
 
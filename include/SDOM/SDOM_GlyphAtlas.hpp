@@ -0,0 +1,131 @@
+#pragma once
+/***  SDOM_GlyphAtlas.hpp  ****************************
+ *
+ * On-demand glyph cache for TrueType fonts.
+ *
+ * Each glyph is rasterized once per (point size, style mask, outline
+ * thickness) variant, in white, and packed into a shared texture page
+ * using a simple shelf allocator. Drawing text then becomes textured quads
+ * from cached pages, tinted per vertex and submitted through SpriteBatch,
+ * instead of a TTF render + texture upload + destroy per glyph or phrase.
+ *
+ * An atlas is owned by a TTFAsset and is cleared whenever that asset is
+ * unloaded (e.g. when Core recreates the renderer), or when it is asked
+ * for a glyph with a renderer it was not built for.
+ *
+ * Released under the ZLIB License.
+ * Original Author: Jay Faries (warte67)
+ *
+ ******************/
+
+#include <SDL3/SDL.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace SDOM
+{
+    class GlyphAtlas
+    {
+    public:
+        static constexpr int PAGE_SIZE = 512;   // default page edge, in pixels
+        static constexpr int PADDING = 1;       // transparent gutter around each glyph
+
+        // Rasterization variant; everything that changes a glyph's pixels
+        // except its color (which is applied as a tint at draw time).
+        struct Variant
+        {
+            float ptSize = 0.0f;
+            int styleMask = TTF_STYLE_NORMAL;
+            int outline = 0;
+        };
+
+        struct Glyph
+        {
+            int page = -1;          // -1 for glyphs with no pixels (e.g. space)
+            SDL_FRect src{};        // source rect within the page texture
+            int advance = 0;        // pen advance without outline
+        };
+
+        struct Stats
+        {
+            std::size_t pages = 0;
+            std::size_t glyphs = 0;
+            std::uint64_t hits = 0;
+            std::uint64_t rasterized = 0;
+        };
+
+        GlyphAtlas() = default;
+        ~GlyphAtlas();
+
+        GlyphAtlas(const GlyphAtlas&) = delete;
+        GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+        // Returns the cached glyph, rasterizing it into a page on a miss.
+        // On a miss the font's style and outline are set to the variant's.
+        // Returns nullptr if the font lacks the glyph or rasterization fails.
+        const Glyph* getGlyph(SDL_Renderer* renderer, TTF_Font* font, Uint32 ch, const Variant& variant);
+
+        // Draws a cached glyph tinted with `color`, top-left at (x, y),
+        // through Core's SpriteBatch (batched when a scope is open)
+        void drawGlyph(SDL_Renderer* renderer, const Glyph& glyph, float x, float y, SDL_Color color) const;
+
+        SDL_Texture* getPageTexture(int page) const;
+
+        // Destroys all pages and forgets every glyph
+        void clear();
+
+        Stats getStats() const;
+
+    private:
+        struct Key
+        {
+            Uint32 ch = 0;
+            int sizeQ = 0;          // point size in 1/64ths
+            int styleMask = 0;
+            int outline = 0;
+
+            bool operator==(const Key& o) const
+            {
+                return ch == o.ch && sizeQ == o.sizeQ && styleMask == o.styleMask && outline == o.outline;
+            }
+        };
+
+        struct KeyHash
+        {
+            std::size_t operator()(const Key& k) const noexcept
+            {
+                std::uint64_t h = (static_cast<std::uint64_t>(k.ch) << 32)
+                                ^ (static_cast<std::uint64_t>(static_cast<std::uint32_t>(k.sizeQ)) << 12)
+                                ^ (static_cast<std::uint64_t>(static_cast<std::uint32_t>(k.outline)) << 4)
+                                ^ static_cast<std::uint64_t>(static_cast<std::uint32_t>(k.styleMask));
+                h ^= h >> 33;
+                h *= 0xff51afd7ed558ccdULL;
+                h ^= h >> 33;
+                return static_cast<std::size_t>(h);
+            }
+        };
+
+        struct Page
+        {
+            SDL_Texture* texture = nullptr;
+            int width = 0;
+            int height = 0;
+            int shelfX = 0;         // next free x on the current shelf
+            int shelfY = 0;         // top of the current shelf
+            int shelfH = 0;         // height of the tallest glyph on the shelf
+        };
+
+        bool allocate_(SDL_Renderer* renderer, int w, int h, int& outPage, int& outX, int& outY);
+        bool addPage_(SDL_Renderer* renderer, int minW, int minH);
+
+        SDL_Renderer* renderer_ = nullptr;
+        std::vector<Page> pages_;
+        std::unordered_map<Key, Glyph, KeyHash> glyphs_;
+        std::uint64_t hits_ = 0;
+        std::uint64_t rasterized_ = 0;
+    }; // END: class GlyphAtlas
+
+} // END: namespace SDOM
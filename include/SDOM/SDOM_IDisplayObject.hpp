@@ -98,10 +98,12 @@ Summary:
 
 // #include <SDOM/SDOM.hpp>   
 #include <SDOM/SDOM_IDataObject.hpp>
+#include <SDOM/SDOM_Atom.hpp>
 #include <iostream>
 #include <algorithm>
 #include <chrono>
 #include <functional>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -201,9 +203,9 @@ namespace SDOM
             GracePeriod         // allows reparenting via DisplayHandle within the grace window.
         };
         OrphanRetentionPolicy getOrphanRetentionPolicy() const { return orphanPolicy_; }
-        IDisplayObject& setOrphanRetentionPolicy(OrphanRetentionPolicy policy) { orphanPolicy_ = policy; return *this; }
+        IDisplayObject& setOrphanRetentionPolicy(OrphanRetentionPolicy policy);
         std::chrono::milliseconds getOrphanGrace() const { return orphanGrace; }
-        IDisplayObject& setOrphanGrace(std::chrono::milliseconds grace) { orphanGrace = grace; return *this; }
+        IDisplayObject& setOrphanGrace(std::chrono::milliseconds grace);
 
     private:
         std::chrono::milliseconds orphanGrace{ORPHAN_GRACE_PERIOD};
@@ -258,6 +260,8 @@ namespace SDOM
             bool tabEnabled   = false;
             bool hasBorder    = true;
             bool hasBackground = true;
+            bool cacheAsBitmap = false;
+            bool clipChildren = false;
 
             // 🔽 Correct signature
             static void from_json(const nlohmann::json& j, InitStruct& init)
@@ -286,6 +290,8 @@ namespace SDOM
 
                 if (j.contains("has_border"))      init.hasBorder     = j["has_border"].get<bool>();
                 if (j.contains("has_background"))  init.hasBackground = j["has_background"].get<bool>();
+                if (j.contains("cache_as_bitmap")) init.cacheAsBitmap = j["cache_as_bitmap"].get<bool>();
+                if (j.contains("clip_children"))   init.clipChildren  = j["clip_children"].get<bool>();
 
                 // ========== Colors ==========
                 if (j.contains("color"))             init.color           = json_to_color(j["color"]);
@@ -305,6 +311,7 @@ namespace SDOM
 
 
         friend class Factory;
+        friend class Core;
 
     protected:
         IDisplayObject(const InitStruct& init);
@@ -317,6 +324,13 @@ namespace SDOM
     
         virtual ~IDisplayObject();
 
+        // --- Pooled Storage --- //
+        // Display objects are carved from per-size slabs (SlabPool::displayObjects()),
+        // so objects of one type are packed together and create/destroy churn
+        // stays off the global heap. Applies to every subclass; main thread only.
+        static void* operator new(std::size_t size);
+        static void operator delete(void* ptr, std::size_t size) noexcept;
+
         // Public non-virtual lifecycle methods. Call these from owners (Factory, Core)
         // to ensure derived classes receive their virtual hooks while object
         // lifetime is still under owner control. These methods are safe to call
@@ -336,6 +350,12 @@ namespace SDOM
         virtual void onUpdate(float fElapsedTime);
         virtual void onEvent(const Event& event);
         virtual void onRender() = 0;
+        // True if onRender() draws to the stage only through Core's
+        // RenderCommandBuffer. Core flushes pending commands before calling
+        // onRender() on objects that return false, so direct SDL calls keep
+        // their painter's order. Override and return false in a subclass
+        // that adds direct SDL drawing to a type that records.
+        virtual bool recordsRenderCommands() const { return false; }
         bool onUnitTest(int frame) override { (void)frame; return true; }
 
         // Called when the Core's logical render size changes or when SDL
@@ -350,11 +370,13 @@ namespace SDOM
         IDisplayObject& setDirty() 
         { 
             bIsDirty_ = true; 
+            dirtySinceRender_ = true;
             return *this; 
         }
         IDisplayObject& setDirty(bool grime) 
         { 
             bIsDirty_ = grime; 
+            if (grime) dirtySinceRender_ = true;
             return *this; 
         }
         bool isDirty() const { return bIsDirty_; }
@@ -400,8 +422,10 @@ namespace SDOM
         bool isOnStage() const;
 
         // --- Type & Property Access --- //
-        std::string getType() const { return type_; }
-        IDisplayObject& setType(const std::string& newType) { type_ = newType; return *this; }
+        const std::string& getType() const { return type_.str(); }
+        Atom getTypeAtom() const { return type_; }     // compare against a cached Atom, no string work
+        IDisplayObject& setType(const std::string& newType);
+        IDisplayObject& setType(Atom newType);     // already interned (Factory creators)
         Bounds getBounds() const { return { getLeft(), getTop(), getRight(), getBottom() }; }
         IDisplayObject& setBounds(const Bounds& b) { setLeft(b.left); setTop(b.top); setRight(b.right); setBottom(b.bottom); return *this; }  // **NEW**
         SDL_Color getColor() const { return color_; }
@@ -432,21 +456,8 @@ namespace SDOM
         IDisplayObject& sendToBack();   // NEW
         IDisplayObject& sendToBackAfter(const IDisplayObject* limitObj); // NEW
         int getZOrder() const { return z_order_; }        
-        IDisplayObject& setZOrder(int z) 
-        { 
-            if (z_order_ != z) 
-            {
-                z_order_ = z;             
-                setParentZOrderDirty(true); 
-            }
-            return *this; 
-        }
-        void setParentZOrderDirty(bool dirty_z) 
-        {
-            if (parent_) {
-                parent_->zOrderDirty_ = dirty_z;
-            }
-        }            
+        IDisplayObject& setZOrder(int z);
+        void setParentZOrderDirty(bool dirty_z);
         bool isZOrderDirty() const { return zOrderDirty_; }
         void sortByZOrder()
         {
@@ -476,6 +487,20 @@ namespace SDOM
         bool isVisible() const { return !isHidden_; }
         IDisplayObject& setVisible(bool visible) { isHidden_ = !visible; setDirty(); return *this; }
 
+        // --- Subtree Bitmap Caching --- //
+        // When set, Core renders this object and all of its descendants into
+        // one retained texture (clipped to this object's bounds) and blits it
+        // while nothing in the subtree is dirty, moved or restructured.
+        bool isCacheAsBitmap() const { return cacheAsBitmap_; }
+        IDisplayObject& setCacheAsBitmap(bool cache) { cacheAsBitmap_ = cache; setDirty(); return *this; }
+
+        // --- Child Clipping --- //
+        // When set, descendants are clipped to this object's bounds and Core
+        // skips any of them that fall entirely outside it (e.g. scrolled-away
+        // content). The object's own drawing is not clipped.
+        bool isClipChildren() const { return clipChildren_; }
+        IDisplayObject& setClipChildren(bool clip) { clipChildren_ = clip; setDirty(); return *this; }
+
         // --- Tab Management --- //
         int getTabPriority() const;
         IDisplayObject& setTabPriority(int index);
@@ -523,10 +548,17 @@ namespace SDOM
         float getLocalTop() const { return top_; }
         float getLocalBottom() const { return bottom_; }
 
-        IDisplayObject& setLocalLeft(float value) { left_ = value; return *this; }
-        IDisplayObject& setLocalRight(float value) { right_ = value; return *this; }
-        IDisplayObject& setLocalTop(float value) { top_ = value; return *this; }
-        IDisplayObject& setLocalBottom(float value) { bottom_ = value; return *this; }
+        IDisplayObject& setLocalLeft(float value) { left_ = value; invalidateWorldBounds(); return *this; }
+        IDisplayObject& setLocalRight(float value) { right_ = value; invalidateWorldBounds(); return *this; }
+        IDisplayObject& setLocalTop(float value) { top_ = value; invalidateWorldBounds(); return *this; }
+        IDisplayObject& setLocalBottom(float value) { bottom_ = value; invalidateWorldBounds(); return *this; }
+
+        // --- World Bounds Cache --- //
+        // World edges are cached per node and rebuilt lazily from the parent's
+        // cached edges. Changing local edges, anchors, or the parent marks this
+        // node and all of its descendants stale.
+        void invalidateWorldBounds();
+        bool isWorldBoundsDirty() const { return worldBoundsDirty_; }
 
 
         // --- Temporary Lua Registration --- //
@@ -537,9 +569,12 @@ namespace SDOM
     protected: // --- Member Variables --- //
         // std::string name_;  // defined in IDataObject
         float left_ = 0.0f, top_ = 0.0f, right_ = 0.0f, bottom_ = 0.0f;  // these are in terms of local not world coordinates
-        std::string type_;  // Type identifier (e.g., "Button", "Panel", etc.)
+        Atom type_;         // Type identifier (e.g., "Button", "Panel", etc.)
         bool bIsDirty_ = false;
         bool zOrderDirty_ = true;
+        // Raised by setDirty() on any object; Core lowers it at the start of each
+        // render pass, so idle mode can ask "did anything change?" in O(1)
+        inline static bool dirtySinceRender_ = false;
         SDL_Color color_ = {255, 255, 255, 255};
 
         SDL_Color foregroundColor_ = {255, 255, 255, 255};   // white
@@ -557,6 +592,8 @@ namespace SDOM
         bool isClickable_ = false;
         bool isEnabled_ = true;
         bool isHidden_ = false;
+        bool cacheAsBitmap_ = false;
+        bool clipChildren_ = false;
         int tabPriority_ = -1;
         bool tabEnabled_ = false;
         bool border_ = false;
@@ -567,6 +604,13 @@ namespace SDOM
         // has been run. Owners must call shutdown() before destroying objects
         // to ensure virtual cleanup hooks run outside destructors.
         bool started_ = false;
+
+    private:
+        // --- World Bounds Cache --- //
+        void updateWorldBounds_() const;
+        mutable Bounds worldBounds_;
+        mutable bool worldBoundsDirty_ = true;
+
     public:
         // --- Event Listener Containers --- //
         struct ListenerEntry {
@@ -574,9 +618,22 @@ namespace SDOM
             int priority;
             EventType eventType;
         };
+        // Listeners registered for a single EventType, keyed by its numeric id
+        struct ListenerBucket {
+            EventType::IdType typeId;
+            std::vector<ListenerEntry> listeners;
+        };
+        // Small vector of buckets sorted by typeId. Objects rarely listen to more
+        // than a handful of types, so a binary search beats hashing the name.
+        using ListenerTable = std::vector<ListenerBucket>;
+
     protected:
-        std::unordered_map<EventType, std::vector<ListenerEntry>, EventTypeHash> captureEventListeners;
-        std::unordered_map<EventType, std::vector<ListenerEntry>, EventTypeHash> bubblingEventListeners;
+        // Allocated on first addEventListener(); objects without listeners pay nothing
+        std::unique_ptr<ListenerTable> captureEventListeners;
+        std::unique_ptr<ListenerTable> bubblingEventListeners;
+
+        static std::vector<ListenerEntry>* findListeners_(const std::unique_ptr<ListenerTable>& table, EventType::IdType typeId);
+        static std::vector<ListenerEntry>& getOrCreateListeners_(std::unique_ptr<ListenerTable>& table, EventType::IdType typeId);
 
         // --- Internal/Utility --- //
         IDisplayObject(const IDisplayObject& other) = delete;
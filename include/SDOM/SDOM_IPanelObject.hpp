@@ -4,6 +4,7 @@
 
 #include "SDOM/SDOM_SpriteSheet.hpp"
 #include "SDOM/SDOM_IDisplayObject.hpp"
+#include "SDOM/SDOM_TexturePool.hpp"
 
 namespace SDOM
 {   
@@ -201,6 +202,7 @@ namespace SDOM
         bool onLoad() override;                 // Allocate/refresh GPU resources after device rebuild
         void onUnload() override;               // Release GPU resources before device teardown
         void onRender() override;               // Called to render the display object
+        bool recordsRenderCommands() const override { return true; }
         void onQuit() override;                 // Called when the display object is being destroyed
         void onUpdate(float fElapsedTime) override =0;    // Called every frame to update the display object
         void onEvent(const Event& event) override =0;     // Called when an event occurs
@@ -235,7 +237,8 @@ namespace SDOM
         PanelBaseIndex base_index_ = PanelBaseIndex::ButtonUp;
         PanelBaseIndex last_base_index_ = PanelBaseIndex::ButtonUp;
 
-        SDL_Texture* cachedTexture_ = nullptr;
+        SDL_Texture* cachedTexture_ = nullptr;    // == cacheLease_.texture
+        TexturePool::Lease cacheLease_;           // leased from Core's texture pool
         SDL_Renderer* cached_renderer_ = nullptr; // renderer that created cachedTexture_
         int current_width_ = 0;
         int current_height_ = 0;
@@ -3,6 +3,7 @@
 
 #include <SDOM/SDOM_IDisplayObject.hpp>
 #include <SDOM/SDOM_SpriteSheet.hpp>
+#include <SDOM/SDOM_TexturePool.hpp>
 #include <algorithm>
 #include <cctype>
 
@@ -138,6 +139,7 @@ namespace SDOM
         void onEvent(const Event& event) override;  // Called when an event occurs
         void onUpdate(float fElapsedTime) override; // Called every frame to update the display object
         void onRender() override;   // Called to render the display object
+        bool recordsRenderCommands() const override { return true; }
         bool onUnitTest(int frame) override; // Unit test method
         void onWindowResize(int logicalWidth, int logicalHeight) override;
 
@@ -176,12 +178,14 @@ namespace SDOM
         virtual void _onValueChanged(float oldValue, float newValue);   
 
         // --- Cached rendering --- //
-        SDL_Texture* cachedTexture_ = nullptr;
+        SDL_Texture* cachedTexture_ = nullptr;    // == cacheLease_.texture
+        TexturePool::Lease cacheLease_;           // leased from Core's texture pool
         SDL_Renderer* cached_renderer_ = nullptr; // renderer that created cachedTexture_
         int current_width_ = 0;
         int current_height_ = 0;
         SDL_PixelFormat current_pixel_format_ = SDL_PIXELFORMAT_UNKNOWN;
         bool rebuildRangeTexture_(int width, int height, SDL_PixelFormat fmt);
+        void syncRangeTexture_();   // follow a relocated cache; repaint if it was lost
 
         // -----------------------------------------------------------------
         // 📜 Data Registry Integration
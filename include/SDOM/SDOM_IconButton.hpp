@@ -106,6 +106,7 @@ namespace SDOM
         // --- Virtual Methods --- //
         bool onInit() override;     // Called when the display object is initialized
         void onRender() override;   // Called to render the display object
+        bool recordsRenderCommands() const override { return true; }
         void onQuit() override;     // Called when the display object is being destroyed
         void onUpdate(float fElapsedTime) override; // Called every frame to update the display object
         void onEvent(const Event& event) override;  // Called when an event occurs
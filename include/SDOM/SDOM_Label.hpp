@@ -4,6 +4,7 @@
 #include <SDOM/SDOM_Utils.hpp>
 #include <SDOM/SDOM_IDisplayObject.hpp>
 #include <SDOM/SDOM_IFontObject.hpp>
+#include <SDOM/SDOM_TexturePool.hpp>
 // #include <external/nlohmann/json.hpp>
 #include <json.hpp>
 
@@ -275,6 +276,7 @@ namespace SDOM
         void onUpdate(float fElapsedTime) override;
         void onEvent(const Event& event) override;
         void onRender() override;
+        bool recordsRenderCommands() const override { return true; }
         bool onUnitTest(int frame) override;
         void onWindowResize(int logicalWidth, int logicalHeight) override;
 
@@ -396,6 +398,9 @@ namespace SDOM
         bool userFontHeightSpecified_ = false;
 
         SDL_Texture* cachedTexture_ = nullptr;
+        // Lease backing cachedTexture_, held from Core's texture pool; the
+        // texture may be larger than the label, so blits use its srcRect().
+        TexturePool::Lease cacheLease_;
         // Track which SDL_Renderer created cachedTexture_ so we can detect
         // renderer changes and invalidate safely.
         SDL_Renderer* cached_renderer_ = nullptr;
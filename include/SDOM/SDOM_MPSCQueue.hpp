@@ -0,0 +1,110 @@
+#pragma once
+/***  SDOM_MPSCQueue.hpp  ****************************
+ *
+ * Bounded, lock-free multi-producer / single-consumer ring buffer.
+ *
+ * Any number of threads may call tryPush() concurrently; exactly one thread
+ * (the SDOM main loop) calls tryPop(). Each cell carries a sequence number
+ * that tells producers whether the slot is free and tells the consumer
+ * whether the slot has been published, so neither side ever blocks. When
+ * the ring is full, tryPush() fails immediately and the caller decides how
+ * to apply back-pressure.
+ *
+ * Released under the ZLIB License.
+ * Original Author: Jay Faries (warte67)
+ *
+ ******************/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace SDOM
+{
+    template<typename T>
+    class MPSCQueue
+    {
+    public:
+        // Capacity is rounded up to the next power of two (minimum 2)
+        explicit MPSCQueue(std::size_t capacity)
+        {
+            std::size_t cap = 2;
+            while (cap < capacity) cap <<= 1;
+            mask_ = cap - 1;
+            cells_ = std::make_unique<Cell[]>(cap);
+            for (std::size_t i = 0; i < cap; ++i)
+                cells_[i].seq.store(i, std::memory_order_relaxed);
+        }
+
+        MPSCQueue(const MPSCQueue&) = delete;
+        MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+        // Producer side (any thread). Returns false if the ring is full;
+        // `value` is left untouched in that case.
+        bool tryPush(T& value)
+        {
+            std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+            Cell* cell = nullptr;
+            for (;;)
+            {
+                cell = &cells_[pos & mask_];
+                const std::size_t seq = cell->seq.load(std::memory_order_acquire);
+                const std::intptr_t dif = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+                if (dif == 0)
+                {
+                    if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (dif < 0)
+                {
+                    return false;   // full
+                }
+                else
+                {
+                    pos = enqueuePos_.load(std::memory_order_relaxed);
+                }
+            }
+            cell->value = std::move(value);
+            cell->seq.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer side (single thread only). Returns false if empty.
+        bool tryPop(T& out)
+        {
+            Cell* cell = &cells_[dequeuePos_ & mask_];
+            const std::size_t seq = cell->seq.load(std::memory_order_acquire);
+            if (seq != dequeuePos_ + 1)
+                return false;
+            out = std::move(cell->value);
+            cell->seq.store(dequeuePos_ + mask_ + 1, std::memory_order_release);
+            ++dequeuePos_;
+            return true;
+        }
+
+        std::size_t capacity() const { return mask_ + 1; }
+
+        // Approximate while producers are active; exact on the consumer when idle
+        std::size_t sizeApprox() const
+        {
+            const std::size_t head = enqueuePos_.load(std::memory_order_relaxed);
+            const std::size_t tail = dequeuePos_;
+            return head > tail ? head - tail : 0;
+        }
+
+    private:
+        struct Cell
+        {
+            std::atomic<std::size_t> seq{0};
+            T value{};
+        };
+
+        std::unique_ptr<Cell[]> cells_;
+        std::size_t mask_ = 0;
+        alignas(64) std::atomic<std::size_t> enqueuePos_{0};
+        alignas(64) std::size_t dequeuePos_ = 0;
+    };
+
+} // namespace SDOM
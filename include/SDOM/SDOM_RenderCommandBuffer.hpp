@@ -0,0 +1,128 @@
+#pragma once
+/***  SDOM_RenderCommandBuffer.hpp  ****************************
+ *
+ * Deferred, state-sorted render commands for the stage pass.
+ *
+ * While Core::onRender() walks the render list, built-in display objects
+ * record fill rects, outline rects, textured quads and clip changes here
+ * instead of calling SDL directly. At submit time commands are grouped by
+ * state (command kind, texture, color, blend/scale mode). A command may
+ * move ahead of earlier commands to join a matching group only when its
+ * bounds do not intersect anything it jumps over, so painter's order is
+ * preserved wherever it is observable. Each group is then issued with one
+ * SDL call: SDL_RenderFillRects / SDL_RenderRects, or a single
+ * SDL_RenderGeometry through SpriteBatch for textured quads.
+ *
+ * Clip changes are barriers: nothing is reordered across them.
+ *
+ * When the buffer is not recording (outside the stage pass) every command
+ * executes immediately, so emitting code works unchanged in any context.
+ * Code that draws directly with SDL while recording must call flush()
+ * first; Core does this for display objects whose recordsRenderCommands()
+ * returns false.
+ *
+ * Released under the ZLIB License.
+ * Original Author: Jay Faries (warte67)
+ *
+ ******************/
+
+#include <SDL3/SDL.h>
+#include <SDOM/SDOM_SpriteBatch.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SDOM
+{
+    class RenderCommandBuffer
+    {
+    public:
+        enum class Kind : std::uint8_t
+        {
+            FillRect,
+            OutlineRect,
+            TexturedQuad,
+            SetClip
+        };
+
+        struct Command
+        {
+            Kind kind = Kind::FillRect;
+            SDL_FRect dst{};                    // bounds for rects and quads
+            SDL_FRect src{};                    // texels; w/h <= 0 means whole texture
+            SDL_Color color{ 255, 255, 255, 255 };
+            SDL_Texture* texture = nullptr;
+            SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
+            SDL_ScaleMode scaleMode = SDL_SCALEMODE_NEAREST;
+            bool clipEnabled = false;           // SetClip only
+            SDL_Rect clip{};                    // SetClip only
+        };
+
+        struct Stats
+        {
+            std::uint64_t recorded = 0;     // commands recorded (excluding clip changes)
+            std::uint64_t submitted = 0;    // SDL draw calls issued for them
+            std::uint64_t merged = 0;       // commands folded into an existing group
+            std::uint64_t reordered = 0;    // of those, commands moved ahead of others
+        };
+
+        RenderCommandBuffer() = default;
+        RenderCommandBuffer(const RenderCommandBuffer&) = delete;
+        RenderCommandBuffer& operator=(const RenderCommandBuffer&) = delete;
+
+        // --- Frame Control (Core) --- //
+        void begin(SDL_Renderer* renderer, SDL_Texture* target);
+        void flush();                       // submit pending commands, keep recording
+        void discard();                     // drop pending commands without submitting them
+        void end();                         // submit and stop recording
+        void setTarget(SDL_Texture* target);  // submit pending commands, then retarget
+        bool isRecording() const { return recording_; }
+
+        // --- Recording --- //
+        void fillRect(const SDL_FRect& rect, SDL_Color color, SDL_BlendMode blend = SDL_BLENDMODE_BLEND);
+        void outlineRect(const SDL_FRect& rect, SDL_Color color, SDL_BlendMode blend = SDL_BLENDMODE_BLEND);
+        // The first form keeps the texture's own scale mode (cached-texture blits).
+        // Both return false, recording nothing, when the texture cannot be drawn
+        // by the current renderer (null, or created by a renderer since replaced).
+        bool texturedQuad(SDL_Texture* texture, const SDL_FRect* src, const SDL_FRect& dst,
+                          SDL_Color tint = { 255, 255, 255, 255 });
+        bool texturedQuad(SDL_Texture* texture, const SDL_FRect* src, const SDL_FRect& dst,
+                          SDL_Color tint, SDL_ScaleMode scaleMode);
+        void setClip(const SDL_Rect* clip);  // nullptr disables clipping
+
+        // --- Statistics --- //
+        Stats getStats() const { return stats_; }               // cumulative
+        Stats getStatsLastFrame() const { return lastFrame_; }  // between the last begin()/end()
+
+        // Drop everything without drawing (renderer teardown)
+        void reset();
+
+    private:
+        static constexpr std::size_t REORDER_WINDOW = 32;  // batches scanned when merging
+
+        void execute_(const Command& cmd);
+        void record_(const Command& cmd);
+        void submitSegment_(std::size_t begin, std::size_t end);
+        void issueBatch_(const std::vector<std::size_t>& members);
+        static bool sameState_(const Command& a, const Command& b);
+        static bool intersects_(const SDL_FRect& a, const SDL_FRect& b);
+        static SDL_FRect unite_(const SDL_FRect& a, const SDL_FRect& b);
+
+        SDL_Renderer* renderer_ = nullptr;
+        SDL_Texture* target_ = nullptr;
+        bool recording_ = false;
+        bool clipTouched_ = false;          // a SetClip ran since begin()
+
+        std::vector<Command> commands_;
+        // Scratch used while grouping; kept to avoid per-frame allocation
+        std::vector<std::vector<std::size_t>> groups_;
+        std::vector<SDL_FRect> groupBounds_;
+        std::vector<SDL_FRect> rectScratch_;
+        SpriteBatch quadBatch_;             // merges textured-quad groups into one geometry call
+
+        Stats stats_;
+        Stats frameStart_;
+        Stats lastFrame_;
+    }; // END: class RenderCommandBuffer
+
+} // END: namespace SDOM
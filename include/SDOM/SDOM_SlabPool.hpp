@@ -0,0 +1,102 @@
+#pragma once
+/***  SDOM_SlabPool.hpp  ****************************
+ *
+ * Fixed-size block allocator backing display object storage.
+ *
+ * Blocks are grouped into size classes, one per distinct allocation size,
+ * which in practice means one per concrete display object type. Each class
+ * carves its blocks out of large slabs and recycles freed blocks through an
+ * intrusive free list, so objects of the same type sit next to each other
+ * in memory and create/destroy churn (popups, list rows) never reaches the
+ * global allocator once a class has warmed up.
+ *
+ * IDisplayObject routes its class operator new/delete here, so every
+ * display object (built-in, user-registered or created from Lua) is pooled
+ * without changes to the TypeCreators that construct them. Sizes too large
+ * to share a slab fall through to the global heap.
+ *
+ * Slabs are kept until trim() finds their size class empty. Not thread
+ * safe: display objects are created and destroyed on the main thread,
+ * like the Factory registry that owns them.
+ *
+ * Released under the ZLIB License.
+ * Original Author: Jay Faries (warte67)
+ *
+ ******************/
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace SDOM
+{
+    class SlabPool
+    {
+    public:
+        static constexpr std::size_t SLAB_BYTES = 64u * 1024u;     // target slab size
+        static constexpr std::size_t MIN_SLAB_BLOCKS = 8;           // blocks per slab for large classes
+        static constexpr std::size_t MAX_BLOCK_SIZE = SLAB_BYTES / MIN_SLAB_BLOCKS;  // larger goes to the heap
+        static constexpr std::size_t ALIGNMENT = alignof(std::max_align_t);
+
+        struct Stats
+        {
+            std::size_t sizeClasses = 0;
+            std::size_t slabs = 0;
+            std::size_t slabBytes = 0;      // memory held by slabs
+            std::size_t capacity = 0;       // blocks in all slabs
+            std::size_t live = 0;           // blocks currently allocated
+            std::uint64_t allocations = 0;  // blocks handed out by the pool
+            std::uint64_t heapFallbacks = 0;    // oversized requests sent to the global heap
+        };
+
+        SlabPool() = default;
+        ~SlabPool();
+        SlabPool(const SlabPool&) = delete;
+        SlabPool& operator=(const SlabPool&) = delete;
+
+        void* allocate(std::size_t size);
+        void deallocate(void* ptr, std::size_t size) noexcept;
+
+        // Grow the class for `size` so `count` more blocks fit without a new slab
+        void reserve(std::size_t size, std::size_t count);
+
+        // Free the slabs of every size class with no live blocks
+        void trim();
+
+        Stats getStats() const;
+        Stats getStats(std::size_t size) const;     // one size class
+
+        // The pool behind IDisplayObject::operator new. Deliberately never
+        // destroyed, so objects released during static teardown stay valid.
+        static SlabPool& displayObjects();
+
+        static std::size_t blockSize(std::size_t size)
+        {
+            return (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+        }
+
+    private:
+        struct FreeBlock { FreeBlock* next; };
+
+        struct SizeClass
+        {
+            std::size_t blockSize = 0;
+            std::size_t slabBlocks = 0;     // blocks per regular slab
+            FreeBlock* freeList = nullptr;
+            std::vector<std::pair<void*, std::size_t>> slabs;   // base, block count
+            std::size_t capacity = 0;
+            std::size_t live = 0;
+            std::uint64_t allocations = 0;
+        };
+
+        SizeClass& sizeClass_(std::size_t blockSize);
+        void grow_(SizeClass& sc, std::size_t blocks);
+        static void release_(SizeClass& sc);
+
+        std::unordered_map<std::size_t, SizeClass> classes_;   // keyed by block size
+        SizeClass* last_ = nullptr;         // creation bursts are usually one type
+        std::uint64_t heapFallbacks_ = 0;
+    }; // END: class SlabPool
+
+} // END: namespace SDOM
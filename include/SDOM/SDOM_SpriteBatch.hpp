@@ -0,0 +1,96 @@
+#pragma once
+/***  SDOM_SpriteBatch.hpp  ****************************
+ *
+ * Accumulates textured quads into a vertex/index buffer and submits them
+ * with a single SDL_RenderGeometry() call per run of identical state.
+ *
+ * Batching is scoped: callers that emit many sprites back-to-back (font
+ * passes, nine-quads) open a Scope, and everything queued inside it is
+ * submitted when the state key (texture, render target, scale mode, blend
+ * mode) changes or the outermost scope closes. Outside a scope addQuad()
+ * draws immediately, so one-off sprites behave exactly as before.
+ *
+ * Anything that draws directly with SDL while a scope is open must call
+ * flush() first to keep painter's order.
+ *
+ * Released under the ZLIB License.
+ * Original Author: Jay Faries (warte67)
+ *
+ ******************/
+
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <vector>
+
+namespace SDOM
+{
+    class SpriteBatch
+    {
+    public:
+        struct Stats
+        {
+            std::uint64_t quads = 0;        // quads submitted (batched or immediate)
+            std::uint64_t drawCalls = 0;    // SDL draw calls issued for those quads
+        };
+
+        // RAII helper: begin() on construction, end() on destruction
+        class Scope
+        {
+        public:
+            explicit Scope(SpriteBatch& batch) : batch_(batch) { batch_.begin(); }
+            ~Scope() { batch_.end(); }
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+        private:
+            SpriteBatch& batch_;
+        };
+
+        SpriteBatch() = default;
+        SpriteBatch(const SpriteBatch&) = delete;
+        SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+        void begin();       // scopes nest; only the outermost end() flushes
+        void end();
+        bool isActive() const { return depth_ > 0; }
+
+        // Axis-aligned quad; `src` is in texels
+        void addQuad(SDL_Renderer* renderer, SDL_Texture* texture,
+                     const SDL_FRect& src, const SDL_FRect& dst,
+                     SDL_Color color, SDL_ScaleMode scaleMode);
+
+        // Arbitrary quad (e.g. italic skew); corners are TL, TR, BR, BL and
+        // `src` is in texels
+        void addQuad(SDL_Renderer* renderer, SDL_Texture* texture,
+                     const SDL_FRect& src, const SDL_FPoint corners[4],
+                     SDL_Color color, SDL_ScaleMode scaleMode);
+
+        // Submit everything queued so far
+        void flush();
+
+        // Drop queued geometry without drawing (renderer teardown)
+        void reset();
+
+        Stats getStats() const { return stats_; }
+        void resetStats() { stats_ = Stats{}; }
+
+    private:
+        bool prepare_(SDL_Renderer* renderer, SDL_Texture* texture, SDL_ScaleMode scaleMode);
+        void pushQuad_(const SDL_FRect& src, const SDL_FPoint corners[4], SDL_Color color);
+
+        int depth_ = 0;
+
+        // Current state key; a change forces a flush
+        SDL_Renderer* renderer_ = nullptr;
+        SDL_Texture* texture_ = nullptr;
+        SDL_Texture* target_ = nullptr;
+        SDL_ScaleMode scaleMode_ = SDL_SCALEMODE_NEAREST;
+        SDL_BlendMode blendMode_ = SDL_BLENDMODE_BLEND;
+        float texW_ = 0.0f;
+        float texH_ = 0.0f;
+
+        std::vector<SDL_Vertex> vertices_;
+        std::vector<int> indices_;
+        Stats stats_;
+    }; // END: class SpriteBatch
+
+} // END: namespace SDOM
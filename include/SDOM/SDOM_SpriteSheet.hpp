@@ -129,13 +129,18 @@ namespace SDOM
         );
 
         // Render a 9-slice panel into the specified target texture using the
-        // tile set starting at baseIndex. The target texture size determines
-        // the output size. Color modulates the sprite color.
+        // tile set starting at baseIndex. The output covers the top-left
+        // width x height of the target (0 means the whole target, e.g. for a
+        // pooled texture larger than the panel). Only that area is cleared, and
+        // it is relative to the viewport if the target is already bound with
+        // one (TexturePool::Target). Color modulates the sprite color.
         void drawNineQuad(
             int baseIndex,
             SDL_Texture* targetTexture,
             SDL_Color color = {255, 255, 255, 255},
-            SDL_ScaleMode scaleMode = SDL_SCALEMODE_NEAREST
+            SDL_ScaleMode scaleMode = SDL_SCALEMODE_NEAREST,
+            int width = 0,
+            int height = 0
         );
 
 
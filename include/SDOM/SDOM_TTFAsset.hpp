@@ -3,6 +3,7 @@
 
 #include <SDL3_ttf/SDL_ttf.h>
 #include <SDOM/SDOM_IAssetObject.hpp>
+#include <SDOM/SDOM_GlyphAtlas.hpp>
 
 namespace SDOM
 {
@@ -96,6 +97,10 @@ namespace SDOM
         TTF_Font* _getTTFFontPtr() const { return ttf_font_; }
         int getFontSize() const { return internalFontSize_; }
 
+        // Rasterized glyph cache shared by every TruetypeFont using this asset
+        GlyphAtlas& getGlyphAtlas() { return glyphAtlas_; }
+        const GlyphAtlas& getGlyphAtlas() const { return glyphAtlas_; }
+
     protected:
         friend Factory;
         friend Core;
@@ -103,6 +108,7 @@ namespace SDOM
         int internalFontSize_ = 10;           // Uniform scaling for both font types
 
         TTF_Font* ttf_font_ = nullptr;
+        GlyphAtlas glyphAtlas_;     // cleared on unload (pages are renderer-bound)
 
         // -----------------------------------------------------------------
         // 📜 Data Registry Integration
@@ -0,0 +1,196 @@
+#pragma once
+/***  SDOM_TexturePool.hpp  ****************************
+ *
+ * Size-bucketed pool of SDL_TEXTUREACCESS_TARGET textures owned by Core.
+ *
+ * Widgets that cache their pixels (Label, IPanelObject, IRangeControl)
+ * lease a render target through a Lease instead of creating and destroying
+ * textures themselves. Requested sizes are rounded up to a bucket (a
+ * multiple of 32 px, or about 1/8 of the size for large dimensions), so a
+ * widget that resizes a few pixels at a time keeps the texture it already
+ * holds, and a released texture is handed to the next request for the same
+ * bucket. Leased textures may therefore be larger than asked for; callers
+ * draw through a Target scope and blit Lease::srcRect().
+ *
+ * Small leases (both bucketed edges <= ATLAS_MAX_SLOT) are not given a
+ * texture of their own: they are shelf-packed into shared ATLAS_PAGE_SIZE
+ * render-target pages, so thousands of labels cost a handful of textures
+ * and their blits merge into one draw call per page. Freed slots are reused
+ * by the next lease of the same bucket. When a page becomes sparse and
+ * fragmented, trim() copies its live slots into other pages and destroys
+ * it; holders pick up the new location through sync().
+ *
+ * Released textures stay pooled until they go unused for IDLE_FRAMES frames
+ * or the pooled bytes exceed the budget, at which point the least recently
+ * used are destroyed (trim(), called once per frame by Core).
+ *
+ * Leases carry an id, so releasing a stale lease after clear() (renderer
+ * teardown) is a harmless no-op even if SDL reuses the texture address.
+ *
+ * Released under the ZLIB License.
+ * Original Author: Jay Faries (warte67)
+ *
+ ******************/
+
+#include <SDL3/SDL.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace SDOM
+{
+    class TexturePool
+    {
+    public:
+        static constexpr int BUCKET_GRANULARITY = 32;                   // smallest bucket step, in pixels
+        static constexpr std::uint64_t IDLE_FRAMES = 300;               // pooled textures unused this long are freed
+        static constexpr std::size_t DEFAULT_BUDGET = 64u * 1024u * 1024u;  // bytes kept in the free pool
+        static constexpr int ATLAS_PAGE_SIZE = 1024;                    // shared page edge, in pixels
+        static constexpr int ATLAS_MAX_SLOT = 256;                      // larger leases get their own texture
+        static constexpr int ATLAS_PADDING = 1;                         // transparent gutter around each slot
+        static constexpr float ATLAS_SPARSE = 0.25f;                    // live fraction below which a page is compacted
+
+        struct Lease
+        {
+            SDL_Texture* texture = nullptr;
+            int x = 0;                  // top-left of the leased area within texture
+            int y = 0;
+            int width = 0;              // requested size; the texture may be larger
+            int height = 0;
+            std::uint64_t id = 0;
+
+            explicit operator bool() const { return texture != nullptr; }
+            SDL_FRect srcRect() const { return { float(x), float(y), float(width), float(height) }; }
+        };
+
+        // RAII: binds a lease as the render target with the viewport and clip
+        // set to its area (so callers draw at local 0,0) and clears that area
+        // to transparent. The destructor flushes Core's SpriteBatch and
+        // restores the previous target.
+        class Target
+        {
+        public:
+            Target(SDL_Renderer* renderer, const Lease& lease);
+            ~Target();
+            Target(const Target&) = delete;
+            Target& operator=(const Target&) = delete;
+            explicit operator bool() const { return bound_; }
+        private:
+            SDL_Renderer* renderer_ = nullptr;
+            SDL_Texture* prevTarget_ = nullptr;
+            bool bound_ = false;
+        };
+
+        struct Stats
+        {
+            std::size_t textures = 0;       // alive, leased or pooled (excluding atlas pages)
+            std::size_t leased = 0;
+            std::size_t leasedBytes = 0;
+            std::size_t pooledBytes = 0;
+            std::uint64_t hits = 0;         // requests served without SDL_CreateTexture
+            std::uint64_t misses = 0;       // requests that created a texture
+            std::uint64_t evictions = 0;    // pooled textures destroyed by trim()
+            std::size_t atlasPages = 0;
+            std::size_t atlasSlots = 0;     // live leases packed into pages
+            std::size_t atlasBytes = 0;     // memory held by atlas pages
+            std::uint64_t relocations = 0;  // slots moved by compaction
+        };
+
+        TexturePool() = default;
+        ~TexturePool();
+        TexturePool(const TexturePool&) = delete;
+        TexturePool& operator=(const TexturePool&) = delete;
+
+        // Make `lease` a target of at least width x height in `format`. Keeps
+        // the current texture (or atlas slot) when it is still valid and in
+        // the same bucket; otherwise releases it and takes one from the pool
+        // (or creates one). Textures are left with BLEND blending and NEAREST
+        // scaling. A zero or negative size releases the lease and returns true.
+        // Holders that change texture state (blend mode) pass allowAtlas = false
+        // to get a texture of their own rather than a slot in a shared page.
+        bool lease(Lease& lease, SDL_Renderer* renderer, int width, int height, SDL_PixelFormat format,
+                   bool allowAtlas = true);
+
+        // Return the texture to the pool and empty the lease
+        void release(Lease& lease);
+
+        // Refresh a lease whose atlas slot may have been relocated. Returns
+        // false (and empties the lease) if its pixels are gone, e.g. after
+        // clear(); the holder must then repaint. Empty leases return true.
+        bool sync(Lease& lease) const;
+
+        // Free pooled textures idle too long or beyond the budget, and compact
+        // at most one sparse atlas page; once per frame, outside the stage pass
+        void trim();
+
+        // Destroy every texture, leased or not (renderer teardown)
+        void clear();
+
+        void setBudget(std::size_t bytes) { budget_ = bytes; }
+        std::size_t getBudget() const { return budget_; }
+        void setAtlasEnabled(bool enabled) { atlasEnabled_ = enabled; }
+        bool isAtlasEnabled() const { return atlasEnabled_; }
+        Stats getStats() const;
+
+        static int bucketSize(int pixels);
+
+    private:
+        struct Entry
+        {
+            int width = 0;              // bucketed texture size
+            int height = 0;
+            SDL_PixelFormat format = SDL_PIXELFORMAT_UNKNOWN;
+            std::size_t bytes = 0;
+            std::uint64_t id = 0;       // current lease id; 0 while pooled
+            std::uint64_t lastUsed = 0; // frame of the last lease or release
+        };
+
+        struct Page
+        {
+            SDL_Texture* texture = nullptr;
+            SDL_PixelFormat format = SDL_PIXELFORMAT_UNKNOWN;
+            int shelfX = 0;             // next free x on the current shelf
+            int shelfY = 0;             // top of the current shelf
+            int shelfH = 0;             // height of the tallest cell on the shelf
+            std::vector<SDL_Rect> freeCells;    // released cells, padding included
+            std::size_t liveArea = 0;   // pixels in leased cells
+            std::size_t usedArea = 0;   // pixels in leased or freed cells
+            std::size_t liveSlots = 0;
+            std::uint64_t lastUsed = 0;
+        };
+
+        struct Slot
+        {
+            Page* page = nullptr;
+            SDL_Rect cell{};            // padding included
+        };
+
+        bool leaseSlot_(Lease& lease, SDL_Renderer* renderer, int bw, int bh, SDL_PixelFormat format);
+        bool allocateCell_(SDL_Renderer* renderer, int cw, int ch, SDL_PixelFormat format,
+                           const Page* exclude, Page*& outPage, SDL_Rect& outCell);
+        Page* addPage_(SDL_Renderer* renderer, SDL_PixelFormat format);
+        void freeCell_(Page& page, const SDL_Rect& cell);
+        void compactPage_(Page& page);
+        void destroyPage_(Page* page);
+        void destroy_(SDL_Texture* texture);
+
+        SDL_Renderer* renderer_ = nullptr;
+        std::unordered_map<SDL_Texture*, Entry> entries_;
+        std::vector<SDL_Texture*> free_;        // pooled textures, most recently released last
+        std::vector<std::unique_ptr<Page>> pages_;
+        std::unordered_map<std::uint64_t, Slot> slots_;   // keyed by lease id
+        bool atlasEnabled_ = true;
+        std::size_t budget_ = DEFAULT_BUDGET;
+        std::size_t leasedBytes_ = 0;
+        std::size_t pooledBytes_ = 0;
+        std::uint64_t nextId_ = 1;
+        std::uint64_t frame_ = 0;
+        std::uint64_t hits_ = 0;
+        std::uint64_t misses_ = 0;
+        std::uint64_t evictions_ = 0;
+        std::uint64_t relocations_ = 0;
+    }; // END: class TexturePool
+
+} // END: namespace SDOM
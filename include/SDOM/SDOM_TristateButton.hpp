@@ -247,6 +247,7 @@ namespace SDOM
         void onUpdate(float fElapsedTime) override;
         void onEvent(const Event& event) override;
         void onRender() override;
+        bool recordsRenderCommands() const override { return true; }
         bool onUnitTest(int frame) override;
 
         // --------------------------------------------------------------------
@@ -113,6 +113,10 @@ namespace SDOM
         void drawOutlineGlyph(Uint32 ch, int x, int y, const FontStyle& style);
         void drawDropShadowGlyph(Uint32 ch, int x, int y, const FontStyle& style);
 
+        // Draws a UTF-8 run from the TTFAsset's glyph atlas (rasterizing misses once)
+        void drawGlyphRun_(const std::string& str, int x, int y, SDL_Color color, int outline, int styleMask);
+        static int styleMaskFor_(const FontStyle& style);
+
         // -----------------------------------------------------------------
         // 📜 Data Registry Integration
         // -----------------------------------------------------------------
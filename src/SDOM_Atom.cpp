@@ -0,0 +1,70 @@
+// SDOM_Atom.cpp
+
+#include <SDOM/SDOM.hpp>
+#include <SDOM/SDOM_Atom.hpp>
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace SDOM
+{
+    struct Atom::Table
+    {
+        std::shared_mutex mutex;
+        std::deque<Entry> entries;      // deque: entries never move once added
+        std::unordered_map<std::string_view, const Entry*> index;  // views into entries
+    };
+
+    // Deliberately never destroyed: static EventTypes intern during static
+    // initialization and atoms may be read during static teardown.
+    Atom::Table& Atom::table_()
+    {
+        static Table* table = new Table();
+        return *table;
+    } // END: Atom::table_()
+
+    const Atom::Entry* Atom::intern_(std::string_view text)
+    {
+        if (text.empty()) return nullptr;
+        Table& table = table_();
+        {
+            std::shared_lock<std::shared_mutex> lock(table.mutex);
+            auto it = table.index.find(text);
+            if (it != table.index.end()) return it->second;
+        }
+
+        std::unique_lock<std::shared_mutex> lock(table.mutex);
+        auto it = table.index.find(text);
+        if (it != table.index.end()) return it->second;     // interned while we waited
+        Entry& entry = table.entries.emplace_back();
+        entry.text.assign(text);
+        entry.id = static_cast<std::uint32_t>(table.entries.size());
+        table.index.emplace(std::string_view(entry.text), &entry);
+        return &entry;
+    } // END: Atom::intern_()
+
+    Atom Atom::find(std::string_view text)
+    {
+        if (text.empty()) return Atom();
+        Table& table = table_();
+        std::shared_lock<std::shared_mutex> lock(table.mutex);
+        auto it = table.index.find(text);
+        return it != table.index.end() ? Atom(it->second) : Atom();
+    } // END: Atom::find()
+
+    std::size_t Atom::count()
+    {
+        Table& table = table_();
+        std::shared_lock<std::shared_mutex> lock(table.mutex);
+        return table.entries.size();
+    } // END: Atom::count()
+
+    const std::string& Atom::empty_()
+    {
+        static const std::string* empty = new std::string();
+        return *empty;
+    } // END: Atom::empty_()
+
+} // END: namespace SDOM
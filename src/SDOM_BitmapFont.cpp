@@ -244,10 +244,8 @@ namespace SDOM
         // --- Prepare outline textures (pre-rendered per-thickness glyph outlines)
         // Clean up any existing outline textures first
         if (!outlineTextures.empty()) {
-            for (auto &vec : outlineTextures) {
-                for (auto *tex : vec) {
-                    if (tex) SDL_DestroyTexture(tex);
-                }
+            for (auto *tex : outlineTextures) {
+                if (tex) SDL_DestroyTexture(tex);
             }
             outlineTextures.clear();
         }
@@ -262,40 +260,45 @@ namespace SDOM
             // Save original render target so we can restore it afterwards
             SDL_Texture* originalTarget = SDL_GetRenderTarget(renderer);
 
+            const int rows = (spriteCount + OUTLINE_ATLAS_COLUMNS - 1) / OUTLINE_ATLAS_COLUMNS;
             for (int t = 1; t <= maxThickness; ++t) {
-                outlineTextures[t-1].resize(spriteCount);
-                for (int i = 0; i < spriteCount; ++i) {
-                    int texW = bitmapFontWidth_ + t * 2;
-                    int texH = bitmapFontHeight_ + t * 2;
-                    SDL_Texture* outTex = SDL_CreateTexture(
-                        renderer,
-                        SDL_PIXELFORMAT_RGBA8888,
-                        SDL_TEXTUREACCESS_TARGET,
-                        texW,
-                        texH
-                    );
-                    if (!outTex) {
-                        ERROR(std::string("Failed to create outline texture: ") + SDL_GetError());
-                        outlineTextures[t-1][i] = nullptr;
-                        continue;
-                    }
-
-                    // Clear the outline texture
-                    SDL_SetRenderTarget(renderer, outTex);
-                    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
-                    SDL_RenderClear(renderer);
+                const int cellW = bitmapFontWidth_ + t * 2 + OUTLINE_CELL_GUTTER * 2;
+                const int cellH = bitmapFontHeight_ + t * 2 + OUTLINE_CELL_GUTTER * 2;
+                SDL_Texture* outTex = SDL_CreateTexture(
+                    renderer,
+                    SDL_PIXELFORMAT_RGBA8888,
+                    SDL_TEXTUREACCESS_TARGET,
+                    cellW * OUTLINE_ATLAS_COLUMNS,
+                    cellH * std::max(rows, 1)
+                );
+                if (!outTex) {
+                    ERROR(std::string("Failed to create outline texture: ") + SDL_GetError());
+                    outlineTextures[t-1] = nullptr;
+                    continue;
+                }
 
-                    // Render the glyph multiple times offset by dx/dy to form an outline
-                    for (int dx = -t; dx <= t; ++dx) {
-                        for (int dy = -t; dy <= t; ++dy) {
-                            // initializeOutlineGlyph expects a character code (sprite index + 32)
-                            initializeOutlineGlyph(i + 32, dx + t, dy + t);
+                // Clear the outline texture
+                SDL_SetRenderTarget(renderer, outTex);
+                SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+                SDL_RenderClear(renderer);
+
+                // Render each glyph multiple times offset by dx/dy to form an outline;
+                // the whole page is submitted as a single geometry batch.
+                {
+                    SpriteBatch::Scope batchScope(getCore().getSpriteBatch());
+                    for (int i = 0; i < spriteCount; ++i) {
+                        SDL_FRect cell = outlineCellRect_(t, i);
+                        for (int dx = -t; dx <= t; ++dx) {
+                            for (int dy = -t; dy <= t; ++dy) {
+                                // initializeOutlineGlyph expects a character code (sprite index + 32)
+                                initializeOutlineGlyph(i + 32, int(cell.x) + dx + t, int(cell.y) + dy + t);
+                            }
                         }
                     }
-
-                    // Store the created texture
-                    outlineTextures[t-1][i] = outTex;
                 }
+
+                // Store the created texture
+                outlineTextures[t-1] = outTex;
             }
 
             // Restore original render target
@@ -321,10 +324,8 @@ namespace SDOM
         }
         // Destroy any outline textures
         if (!outlineTextures.empty()) {
-            for (auto &vec : outlineTextures) {
-                for (auto *tex : vec) {
-                    if (tex) SDL_DestroyTexture(tex);
-                }
+            for (auto *tex : outlineTextures) {
+                if (tex) SDL_DestroyTexture(tex);
             }
             outlineTextures.clear();
         }
@@ -413,6 +414,8 @@ namespace SDOM
             return;
         }
 
+        SpriteBatch::Scope batchScope(getCore().getSpriteBatch());
+
         // Draw Drop Shadow
         drawDropShadowGlyph(ch, x, y, style);
 
@@ -427,6 +430,8 @@ namespace SDOM
     {
         if (!spriteSheet_) return;
 
+        SpriteBatch::Scope batchScope(getCore().getSpriteBatch());
+
         // Pass 3: Foreground
         int cursorX = x;
         for (char ch : str) 
@@ -440,6 +445,8 @@ namespace SDOM
     {
         if (!spriteSheet_) return;
 
+        SpriteBatch::Scope batchScope(getCore().getSpriteBatch());
+
         // Pass 2: Outline
         if (style.outline && style.outlineThickness > 0) 
         {
@@ -456,6 +463,8 @@ namespace SDOM
     {
         if (!spriteSheet_) return;
 
+        SpriteBatch::Scope batchScope(getCore().getSpriteBatch());
+
         // Pass 1: Drop Shadow
         if (style.dropshadow) 
         {
@@ -618,36 +627,16 @@ namespace SDOM
 
             int glyphX = ss->getSpriteX(spriteIndex);
             int glyphY = ss->getSpriteY(spriteIndex);
-            int sheetW = fontTexture->w;
-            int sheetH = fontTexture->h;
-
-            // Texture coordinates (normalized) use canonical sprite sizes
-            float u0 = float(glyphX) / sheetW;
-            float v0 = float(glyphY) / sheetH;
-            float u1 = float(glyphX + bitmapFontWidth_) / sheetW;
-            float v1 = float(glyphY + bitmapFontHeight_) / sheetH;
-
-            SDL_Vertex vertices[4] = {
-                // Top-left (skewed right)
-                { { float(x) + slant, float(y) }, { color.r/255.0f, color.g/255.0f, color.b/255.0f, color.a/255.0f }, { u0, v0 } },
-                // Top-right (skewed right)
-                { { float(x + scaledWidth) + slant, float(y) }, { color.r/255.0f, color.g/255.0f, color.b/255.0f, color.a/255.0f }, { u1, v0 } },
-                // Bottom-right
-                { { float(x + scaledWidth) - slant, float(y + scaledHeight) }, { color.r/255.0f, color.g/255.0f, color.b/255.0f, color.a/255.0f }, { u1, v1 } },
-                // Bottom-left
-                { { float(x) - slant, float(y + scaledHeight) }, { color.r/255.0f, color.g/255.0f, color.b/255.0f, color.a/255.0f }, { u0, v1 } }
-            };
-            int indices[6] = { 0, 1, 2, 0, 2, 3 };
-
-            // SDL_SCALEMODE_NEAREST  
-            // SDL_SCALEMODE_LINEAR   
-            // SDL_SCALEMODE_PIXELART 
-            SDL_SetTextureScaleMode(fontTexture, SDL_SCALEMODE_NEAREST);
-
-            if (!SDL_RenderGeometry(renderer, fontTexture, vertices, 4, indices, 6)) {
-                ERROR(std::string("Failed to render skewed glyph: ") + SDL_GetError());
-            }
 
+            // Source rect uses canonical sprite sizes
+            SDL_FRect src = { float(glyphX), float(glyphY), float(bitmapFontWidth_), float(bitmapFontHeight_) };
+            SDL_FPoint corners[4] = {
+                { float(x) + slant, float(y) },                                 // Top-left (skewed right)
+                { float(x + scaledWidth) + slant, float(y) },                   // Top-right (skewed right)
+                { float(x + scaledWidth) - slant, float(y + scaledHeight) },    // Bottom-right
+                { float(x) - slant, float(y + scaledHeight) }                   // Bottom-left
+            };
+            getCore().getSpriteBatch().addQuad(renderer, fontTexture, src, corners, color, SDL_SCALEMODE_NEAREST);
         }   
         if (style.underline) 
         {
@@ -659,6 +648,7 @@ namespace SDOM
 
             // Underline position: just above the bottom of the glyph box
             float underlineY = y + scaledHeight - 1;
+            getCore().getSpriteBatch().flush();   // keep painter's order with queued glyphs
             SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a - (color.a/3));
             SDL_RenderLine(renderer, float(x), underlineY, float(x + scaledWidth - 1), underlineY);
         }
@@ -672,6 +662,7 @@ namespace SDOM
 
             // Strikethrough position: centered vertically (favoring above center for even heights)
             float strikeY = y + (scaledHeight / 2) - (scaledHeight % 2 == 0 ? 1 : 0) + 1;
+            getCore().getSpriteBatch().flush();   // keep painter's order with queued glyphs
             SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a - (color.a/3));
             SDL_RenderLine(renderer, float(x), strikeY, float(x + scaledWidth - 1), strikeY);
         }
@@ -749,12 +740,10 @@ namespace SDOM
             destRect.w = destW;
             destRect.h = destH;
 
-            SDL_Texture* outlineTex = outlineTextures[thickness - 1][spriteIndex];
+            SDL_Texture* outlineTex = outlineTextures[thickness - 1];
             if (outlineTex) {
-                SDL_SetTextureColorMod(outlineTex, style.outlineColor.r, style.outlineColor.g, style.outlineColor.b);
-                SDL_SetTextureAlphaMod(outlineTex, style.outlineColor.a);
-                SDL_SetTextureScaleMode(outlineTex, SDL_SCALEMODE_LINEAR);
-                SDL_RenderTexture(renderer, outlineTex, nullptr, &destRect);
+                getCore().getSpriteBatch().addQuad(renderer, outlineTex, outlineCellRect_(thickness, spriteIndex),
+                                                   destRect, style.outlineColor, SDL_SCALEMODE_LINEAR);
             }
         }
     } // END drawOutlineGlyph()
@@ -812,17 +801,30 @@ namespace SDOM
         destRect.w = (scaledWidth + scaledThickness * 2);
         destRect.h = (scaledHeight + scaledThickness * 2);
 
-        SDL_Texture* outlineTex = outlineTextures[thickness - 1][spriteIndex];
+        SDL_Texture* outlineTex = outlineTextures[thickness - 1];
         if (outlineTex) {
-            SDL_SetTextureColorMod(outlineTex, style.dropshadowColor.r, style.dropshadowColor.g, style.dropshadowColor.b);
-            SDL_SetTextureAlphaMod(outlineTex, style.dropshadowColor.a);
-            SDL_SetTextureScaleMode(outlineTex, SDL_SCALEMODE_LINEAR);
-            SDL_RenderTexture(renderer, outlineTex, nullptr, &destRect);
-        }       
+            getCore().getSpriteBatch().addQuad(renderer, outlineTex, outlineCellRect_(thickness, spriteIndex),
+                                               destRect, style.dropshadowColor, SDL_SCALEMODE_LINEAR);
+        }
     } // END drawDropShadowGlyph()
 
 
     
+    SDL_FRect BitmapFont::outlineCellRect_(int thickness, int spriteIndex) const
+    {
+        const int cellW = bitmapFontWidth_ + thickness * 2 + OUTLINE_CELL_GUTTER * 2;
+        const int cellH = bitmapFontHeight_ + thickness * 2 + OUTLINE_CELL_GUTTER * 2;
+        const int col = spriteIndex % OUTLINE_ATLAS_COLUMNS;
+        const int row = spriteIndex / OUTLINE_ATLAS_COLUMNS;
+        return SDL_FRect{
+            float(col * cellW + OUTLINE_CELL_GUTTER),
+            float(row * cellH + OUTLINE_CELL_GUTTER),
+            float(cellW - OUTLINE_CELL_GUTTER * 2),
+            float(cellH - OUTLINE_CELL_GUTTER * 2)
+        };
+    } // END outlineCellRect_()
+
+    
     void BitmapFont::registerBindingsImpl(const std::string& typeName)
     {
         SUPER::registerBindingsImpl(typeName);
@@ -790,6 +790,7 @@ void CAPI_BindGenerator::generateHeader(const BindModule& module)
         out << "    SDL_WindowFlags windowFlags;\n";
         out << "    SDL_PixelFormat pixelFormat;\n";
         out << "    SDL_Color color;\n";
+        out << "    int headless;\n";
         out << "} SDOM_CoreConfig;\n\n";
         out << "#define SDOM_CORECONFIG_DEFAULT  { \\\n";
         out << "    800.0f, 600.0f, \\\n";
@@ -799,7 +800,8 @@ void CAPI_BindGenerator::generateHeader(const BindModule& module)
         out << "    SDL_LOGICAL_PRESENTATION_LETTERBOX, \\\n";
         out << "    SDL_WINDOW_RESIZABLE, \\\n";
         out << "    SDL_PIXELFORMAT_RGBA8888, \\\n";
-        out << "    { 32, 32, 32, 255 } \\\n";
+        out << "    { 32, 32, 32, 255 }, \\\n";
+        out << "    0 \\\n";
         out << "}\n\n";
     }
 
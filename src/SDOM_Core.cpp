@@ -2,9 +2,11 @@
 #include <SDL3_ttf/SDL_ttf.h>
 #include <algorithm>
 #include <cctype>
+#include <cmath>
 #include <filesystem>
 #include <fstream>
 #include <iterator>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -33,53 +35,52 @@ namespace SDOM
         using json = nlohmann::json;
         using NodeLookup = std::unordered_map<std::string, DisplayHandle>;
 
-        DisplayHandle buildNodeFromJson(Factory& factory,
-                                        const json& node,
-                                        NodeLookup& lookup,
-                                        DisplayHandle& firstStage)
+        // Document-order (preorder) flattening of a JSON subtree. Nodes are
+        // created in one bulk Factory call and then wired together, so unlike
+        // the old recursive builder every node is constructed and receives
+        // OnInit before any addChild() runs: OnInit handlers see parentless
+        // objects, and Added/AddedToStage follow once the tree is wired.
+        struct FlatNode
+        {
+            const json* node = nullptr;
+            int parent = -1;                // index into the flat list
+            std::vector<int> children;
+        };
+
+        void flattenNodeJson(const json& node, int parent, std::vector<FlatNode>& flat)
         {
             if (!node.is_object())
             {
-                WARNING("buildNodeFromJson: skipping non-object node");
-                return {};
+                WARNING("Core::buildDomFromJson: skipping non-object node");
+                return;
             }
-
-            const std::string type = node.value("type", "");
-            if (type.empty())
+            if (node.value("type", "").empty())
             {
-                WARNING("buildNodeFromJson: node missing 'type'");
-                return {};
+                WARNING("Core::buildDomFromJson: node missing 'type'");
+                return;
             }
 
-            DisplayHandle handle = factory.createDisplayObjectFromJson(type, node);
-            if (!handle.isValid())
-            {
-                WARNING(std::string("buildNodeFromJson: failed to create display object of type '") + type + "'");
-                return {};
-            }
-
-            if (auto name = handle.getName(); !name.empty())
-            {
-                lookup[name] = handle;
-            }
-            if (!firstStage.isValid() && type == Stage::TypeName)
-            {
-                firstStage = handle;
-            }
+            const int index = static_cast<int>(flat.size());
+            flat.push_back(FlatNode{ &node, parent, {} });
+            if (parent >= 0) flat[parent].children.push_back(index);
 
             if (auto childIt = node.find("children"); childIt != node.end() && childIt->is_array())
             {
                 for (const auto& child : *childIt)
-                {
-                    DisplayHandle childHandle = buildNodeFromJson(factory, child, lookup, firstStage);
-                    if (childHandle.isValid())
-                    {
-                        handle->addChild(childHandle);
-                    }
-                }
+                    flattenNodeJson(child, index, flat);
             }
+        }
 
-            return handle;
+        // Children are attached bottom-up, so every subtree is complete before
+        // it joins its parent, and siblings join in document order.
+        void attachFlatNode(std::vector<FlatNode>& flat, std::vector<DisplayHandle>& handles, int index)
+        {
+            for (int child : flat[index].children)
+            {
+                attachFlatNode(flat, handles, child);
+                if (handles[index].isValid() && handles[child].isValid())
+                    handles[index]->addChild(handles[child]);
+            }
         }
     }
 
@@ -95,6 +96,7 @@ namespace SDOM
 
         factory_ = new Factory();
         eventManager_ = new EventManager();
+        postTarget_.store(eventManager_);
         version_ = new Version();
         version_->registerBindings("Version", getDataRegistry());
 
@@ -128,6 +130,10 @@ namespace SDOM
         }
         if (eventManager_)
         {
+            // Stop accepting posts from other threads before teardown
+            postTarget_.store(nullptr);
+            while (postsInFlight_.load() != 0)
+                std::this_thread::yield();
             delete eventManager_;
             eventManager_ = nullptr;
         }
@@ -146,6 +152,7 @@ namespace SDOM
         // Adopt the new configuration as current so getters reflect latest values
         // even when SDL was already started.
         config_ = config;
+        config_.headless = headless_;   // reconfigure() may have refused the change
 
         // Initialize the Factory if it hasn't been initialized yet.
         if (factory_ && !factory_->isInitialized()) {
@@ -184,6 +191,7 @@ namespace SDOM
             set_float("pixelHeight", cfg.pixelHeight);
             set_bool("allowTextureResize", cfg.allowTextureResize);
             set_bool("preserveAspectRatio", cfg.preserveAspectRatio);
+            set_bool("headless", cfg.headless);
 
             if (doc.contains("rendererVSync"))
             {
@@ -344,13 +352,62 @@ namespace SDOM
             }
             else
             {
+                std::vector<FlatNode> flat;
                 for (const auto& stageJson : *childrenIt)
+                    flattenNodeJson(stageJson, -1, flat);
+
+                std::vector<const json*> nodes;
+                std::vector<int> parents;
+                nodes.reserve(flat.size());
+                parents.reserve(flat.size());
+                for (const FlatNode& f : flat)
                 {
-                    DisplayHandle handle = buildNodeFromJson(factory, stageJson, lookup, firstStage);
-                    if (handle.isValid() && stageJson.value("type", std::string{}) == Stage::TypeName)
+                    nodes.push_back(f.node);
+                    parents.push_back(f.parent);
+                }
+                factory.reserveRegistry(flat.size());
+                // The Factory does not build under a node it failed to construct
+                std::vector<DisplayHandle> handles = factory.createDisplayObjectsFromJson(nodes, parents);
+
+                // A node that failed takes its subtree with it. Only a node
+                // destroyed during its own startup or OnInit leaves children
+                // behind to clean up here.
+                for (std::size_t i = 0; i < flat.size(); ++i)
+                {
+                    const int parent = flat[i].parent;
+                    const bool parentFailed = (parent >= 0 && !handles[parent].isValid());
+                    const std::string type = flat[i].node->value("type", "");
+                    if (parentFailed)
+                    {
+                        if (handles[i].isValid())
+                            factory.destroyDisplayObject(handles[i].getName());
+                        handles[i] = DisplayHandle();
+                        continue;
+                    }
+                    if (!handles[i].isValid())
+                    {
+                        WARNING(std::string("Core::buildDomFromJson: failed to create display object of type '") + type + "'");
+                        continue;
+                    }
+
+                    if (auto name = handles[i].getName(); !name.empty())
                     {
-                        topLevelStages.push_back(handle);
+                        lookup[name] = handles[i];
                     }
+                    if (!firstStage.isValid() && type == Stage::TypeName)
+                    {
+                        firstStage = handles[i];
+                    }
+                    if (parent < 0 && type == Stage::TypeName)
+                    {
+                        topLevelStages.push_back(handles[i]);
+                    }
+                }
+
+                for (std::size_t i = 0; i < flat.size(); ++i)
+                {
+                    if (flat[i].parent < 0)
+                        attachFlatNode(flat, handles, static_cast<int>(i));
                 }
             }
         }
@@ -440,9 +497,17 @@ namespace SDOM
             texture_ = nullptr;
         }
         if (renderer_) {
+            spriteBatch_.reset();
+            renderCommands_.reset();
+            releaseSubtreeCaches_();
+            texturePool_.clear();
             SDL_DestroyRenderer(renderer_);
             renderer_ = nullptr;
         }
+        if (framebuffer_) {
+            SDL_DestroySurface(framebuffer_);
+            framebuffer_ = nullptr;
+        }
         if (window_) {
             SDL_DestroyWindow(window_);
             window_ = nullptr;
@@ -475,6 +540,8 @@ namespace SDOM
         // pixelWidth                  | No change | No change | Recreate | Texture recreated (pixel sizing)
         // pixelHeight                 | No change | No change | Recreate | Texture recreated (pixel sizing)
         // pixelFormat                 | No change | No change | Recreate | Texture recreated (pixel format)
+        // headless                    | -         | -         | -        | Only applied before SDL video starts; the frame buffer
+        //                             |           |           |          | is the renderer target, so texture changes recreate both
 
         // Legend:
         // - "Recreate" = Core will destroy and recreate that SDL resource immediately when the config changes.
@@ -516,6 +583,10 @@ namespace SDOM
         // -- initialize or reconfigure SDL resources as needed -- //
         if (!SDL_WasInit(SDL_INIT_VIDEO)) 
         {
+            // The video driver is chosen by SDL_Init, so headless is fixed here
+            headless_ = config.headless;
+            if (headless_)
+                SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen,dummy");
             if (!SDL_Init(SDL_INIT_VIDEO)) 
             {
                 std::string errorMsg = "SDL_Init() Error: " + std::string(SDL_GetError());
@@ -530,6 +601,15 @@ namespace SDOM
             }
             recreate_window = recreate_renderer = recreate_texture = true;
         }
+        else if (config.headless != headless_)
+        {
+            WARNING("Core::reconfigure: 'headless' cannot change after SDL video is initialized; ignored");
+        }
+        config_.headless = headless_;
+
+        // The software renderer draws straight into a surface sized to the stage texture
+        if (headless_ && recreate_texture)
+            recreate_renderer = true;
 
         // Before destroying SDL resources, proactively notify all display objects
         // so they can release cached renderer-owned resources (textures) while
@@ -566,8 +646,17 @@ namespace SDOM
         if (recreate_renderer && renderer_) 
         {
             getFactory().unloadAllAssetObjects(); // unload all assets to ensure compatibility with new SDL resources
+            spriteBatch_.reset();
+            renderCommands_.reset();
+            releaseSubtreeCaches_();
+            texturePool_.clear();
             SDL_DestroyRenderer(renderer_);
             renderer_ = nullptr;
+            if (framebuffer_)
+            {
+                SDL_DestroySurface(framebuffer_);
+                framebuffer_ = nullptr;
+            }
         }
         if (recreate_window && window_) 
         {
@@ -576,20 +665,52 @@ namespace SDOM
             window_ = nullptr;
         }
 
+        // compute texture size safely (avoid divide-by-zero and ensure >=1)
+        int tWidth = 1;
+        int tHeight = 1;
+        if (config_.pixelWidth != 0.0f) tWidth = std::max(1, static_cast<int>(config_.windowWidth / config_.pixelWidth));
+        if (config_.pixelHeight != 0.0f) tHeight = std::max(1, static_cast<int>(config_.windowHeight / config_.pixelHeight));
+
         // recreate in normal order
         if (recreate_window && !window_) 
         {
-            window_ = SDL_CreateWindow(getWindowTitle().c_str(), config_.windowWidth, config_.windowHeight, config_.windowFlags);
-            if (!window_) 
+            if (headless_)
             {
-                std::string errorMsg = "SDL_CreateWindow() Error: " + std::string(SDL_GetError());
-                ERROR(errorMsg);
+                // Keeps window queries and events working; nothing reads it otherwise
+                window_ = SDL_CreateWindow(getWindowTitle().c_str(), config_.windowWidth, config_.windowHeight,
+                                           config_.windowFlags | SDL_WINDOW_HIDDEN);
+                if (!window_)
+                    DEBUG_LOG(std::string("Core::reconfigure: headless window unavailable: ") + SDL_GetError());
+            }
+            else
+            {
+                window_ = SDL_CreateWindow(getWindowTitle().c_str(), config_.windowWidth, config_.windowHeight, config_.windowFlags);
+                if (!window_) 
+                {
+                    std::string errorMsg = "SDL_CreateWindow() Error: " + std::string(SDL_GetError());
+                    ERROR(errorMsg);
+                }
+                SDL_ShowWindow(window_);     // not needed in SDL3, but included for clarity
+                SDL_SyncWindow(window_);
             }
-            SDL_ShowWindow(window_);     // not needed in SDL3, but included for clarity
-            SDL_SyncWindow(window_);
         }
         
-        if (recreate_renderer && !renderer_) 
+        if (recreate_renderer && !renderer_ && headless_)
+        {
+            framebuffer_ = SDL_CreateSurface(tWidth, tHeight, config_.pixelFormat);
+            if (!framebuffer_)
+            {
+                std::string errorMsg = "SDL_CreateSurface() Error: " + std::string(SDL_GetError());
+                ERROR(errorMsg);
+            }
+            renderer_ = SDL_CreateSoftwareRenderer(framebuffer_);
+            if (!renderer_)
+            {
+                std::string errorMsg = "SDL_CreateSoftwareRenderer() Error: " + std::string(SDL_GetError());
+                ERROR(errorMsg);
+            }
+        }
+        else if (recreate_renderer && !renderer_) 
         {
             renderer_ = SDL_CreateRenderer(window_, nullptr);
             if (!renderer_) {
@@ -610,7 +731,7 @@ namespace SDOM
                 }
             }
         }
-        else if (!recreate_renderer && renderer_ && rendererVSync_changed)
+        else if (!recreate_renderer && renderer_ && rendererVSync_changed && !headless_)
         {
             if (!SDL_SetRenderVSync(renderer_, config_.rendererVSync))
             {
@@ -625,11 +746,6 @@ namespace SDOM
         }
         if (recreate_texture && !texture_) 
         {
-            // compute texture size safely (avoid divide-by-zero and ensure >=1)
-            int tWidth = 1;
-            int tHeight = 1;
-            if (config_.pixelWidth != 0.0f) tWidth = std::max(1, static_cast<int>(config_.windowWidth / config_.pixelWidth));
-            if (config_.pixelHeight != 0.0f) tHeight = std::max(1, static_cast<int>(config_.windowHeight / config_.pixelHeight));
             texture_ = SDL_CreateTexture(renderer_,
                 config_.pixelFormat,
                 SDL_TEXTUREACCESS_TARGET,
@@ -655,13 +771,106 @@ namespace SDOM
         sdlStarted_ = true;
     }
 
+    Core::FrameBuffer Core::getFrameBuffer() const
+    {
+        FrameBuffer fb;
+        if (!framebuffer_)
+            return fb;
+        fb.pixels = framebuffer_->pixels;
+        fb.width = framebuffer_->w;
+        fb.height = framebuffer_->h;
+        fb.pitch = framebuffer_->pitch;
+        fb.format = framebuffer_->format;
+        return fb;
+    } // END: Core::getFrameBuffer()
+
+    bool Core::saveFrameBuffer(const std::string& bmpPath) const
+    {
+        if (!framebuffer_)
+        {
+            WARNING("Core::saveFrameBuffer: no frame buffer (Core is not headless)");
+            return false;
+        }
+        if (!SDL_SaveBMP(framebuffer_, bmpPath.c_str()))
+        {
+            WARNING("Core::saveFrameBuffer: SDL_SaveBMP('" + bmpPath + "') failed: " + SDL_GetError());
+            return false;
+        }
+        return true;
+    } // END: Core::saveFrameBuffer()
+
     void Core::requestConfigApply(const CoreConfig& cfg)
     {
-        std::lock_guard<std::mutex> lock(pendingConfigMutex_);
-        pendingConfig_ = cfg;
-        pendingConfigRequested_.store(true, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(pendingConfigMutex_);
+            pendingConfig_ = cfg;
+            pendingConfigRequested_.store(true, std::memory_order_release);
+        }
+        wakeFromIdle();
     }
 
+    void Core::setIdleMode(bool enabled)
+    {
+        if (enabled && idleWakeEventType_ == 0)
+        {
+            idleWakeEventType_ = SDL_RegisterEvents(1);
+            if (idleWakeEventType_ == 0)
+                WARNING("Core::setIdleMode: no SDL user event available; cross-thread posts will wait for the next timeout");
+        }
+        idleMode_ = enabled;
+        frameRequested_ = true;
+    } // END: Core::setIdleMode()
+
+    void Core::scheduleWakeup(float seconds)
+    {
+        const Uint64 now = SDL_GetPerformanceCounter();
+        const Uint64 delta = static_cast<Uint64>(std::max(0.0f, seconds) * static_cast<float>(SDL_GetPerformanceFrequency()));
+        const Uint64 at = now + delta;
+        if (wakeupAt_ == 0 || at < wakeupAt_)
+            wakeupAt_ = at;
+    } // END: Core::scheduleWakeup()
+
+    void Core::wakeFromIdle()
+    {
+        // Only the first waker pays for an SDL event
+        if (!idleWaiting_.exchange(false) || idleWakeEventType_ == 0)
+            return;
+        SDL_Event wake{};
+        wake.type = idleWakeEventType_;
+        SDL_PushEvent(&wake);
+    } // END: Core::wakeFromIdle()
+
+    bool Core::wouldIdle() const
+    {
+        if (!idleMode_ || frameRequested_ || !bIsRunning_)
+            return false;
+        if (pendingConfigRequested_.load(std::memory_order_acquire))
+            return false;
+        if (wakeupAt_ && SDL_GetPerformanceCounter() >= wakeupAt_)
+            return false;
+        if (eventManager_ && eventManager_->hasPendingEvents())
+            return false;
+        if (renderListDirty_ || sdlEventBatch_.size() > 0)
+            return false;
+        // Something was marked dirty since the last render pass started
+        if (IDisplayObject::dirtySinceRender_)
+            return false;
+        return true;
+    } // END: Core::wouldIdle()
+
+    Uint32 Core::idleWaitMs_() const
+    {
+        Uint32 wait = idleMaxWaitMs_;
+        if (wakeupAt_)
+        {
+            const Uint64 now = SDL_GetPerformanceCounter();
+            const Uint64 ticks = (wakeupAt_ > now) ? wakeupAt_ - now : 0;
+            const Uint64 ms = ticks * 1000 / SDL_GetPerformanceFrequency();
+            wait = static_cast<Uint32>(std::min<Uint64>(wait, ms));
+        }
+        return wait;
+    } // END: Core::idleWaitMs_()
+
     void Core::applyPendingConfig()
     {
         if (!pendingConfigRequested_.load(std::memory_order_acquire))
@@ -714,11 +923,51 @@ namespace SDOM
 
 
             clearKeyboardFocusedObject(); // ensure no keyboard focus at start of run loop
+            lastFrameTime_ = SDL_GetPerformanceCounter();
+            wasIdle_ = false;
 
             while (bIsRunning_) 
             {
+                // Idle mode: sleep until something needs a frame. The flag is
+                // raised before the check so a post from another thread either
+                // shows up in the check or interrupts the wait.
+                if (idleMode_)
+                {
+                    idleWaiting_.store(true);
+                    if (wouldIdle())
+                        SDL_WaitEventTimeout(nullptr, static_cast<Sint32>(idleWaitMs_()));
+                    idleWaiting_.store(false);
+                    if (wouldIdle() && !SDL_HasEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST))
+                    {
+                        // Orphans still age while idle; collecting one dirties the
+                        // render list, which ends the idle stretch
+                        factory_->detachOrphans();
+                        factory_->attachFutureChildren();
+                        factory_->collectGarbage();
+                        ++idleSkippedFrames_;
+                        wasIdle_ = true;
+                        continue;
+                    }
+                }
+                // The first frame after a sleep must not see the sleep as elapsed time
+                if (wasIdle_)
+                {
+                    lastFrameTime_ = SDL_GetPerformanceCounter();
+                    wasIdle_ = false;
+                }
+                frameRequested_ = false;
+                if (wakeupAt_ && SDL_GetPerformanceCounter() >= wakeupAt_)
+                    wakeupAt_ = 0;
+                // The keyboard focus border pulses; keep it moving at a modest rate
+                if (idleMode_ && keyboardFocusedObject_.isValid())
+                    scheduleWakeup(FOCUS_FLASH_MS / 1000.0f);
+
                 while (SDL_PollEvent(&event)) 
                 {
+                    // Only used to interrupt an idle wait
+                    if (idleWakeEventType_ && event.type == idleWakeEventType_)
+                        continue;
+
                     // If configured to ignore real mouse input, drop any mouse events
                     if (this->getIgnoreRealInput()) {
                         // Drop real mouse and keyboard input while unit tests run so
@@ -757,11 +1006,31 @@ namespace SDOM
                         }
                     // END TEMPORARY              
 
+                    ++sdlEventsPolled_;
+
+                    // Batched mode: collect now, dispatch once after the poll loop
+                    if (sdlEventBatching_ && eventManager_)
+                    {
+                        const EventType* et = EventManager::eventTypeForSDL(event.type);
+                        if (et && et->getBatchPolicy() == EventType::BatchPolicy::Immediate)
+                        {
+                            flushSDLEventBatch_();
+                            sdlEventBatch_.push_back(event);
+                            flushSDLEventBatch_();
+                        }
+                        else
+                        {
+                            EventManager::batchSDL_Event(sdlEventBatch_, event);
+                        }
+                        continue;
+                    }
+
                     // Handle and dispatch events based on the SDL_Event                
                     if (eventManager_) 
                     {
                         eventManager_->Queue_SDL_Event(event);
                         eventManager_->DispatchQueuedEvents();
+                        ++sdlEventsDispatched_;
 
                         // handle TAB keypress
                         if (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_TAB) 
@@ -793,17 +1062,25 @@ namespace SDOM
                         auto ev = std::make_unique<Event>(EventType::OnEvent, rootHandle);
                         ev->setSDL_Event(event);
                         ev->setRelatedTarget(rootHandle);
-                        eventManager_->dispatchEvent(std::move(ev), DisplayHandle(rootHandle.getName(), rootHandle.getType()));
+                        eventManager_->dispatchEvent(std::move(ev), DisplayHandle(rootHandle.getName(), rootHandle.getTypeAtom()));
 
                         // dispatch SDL_Event to rootNode_ so global listeners can inspect raw SDL_Events
                         auto sdl_ev = std::make_unique<Event>(EventType::SDL_Event, rootHandle);
                         sdl_ev->setSDL_Event(event);
                         sdl_ev->setRelatedTarget(rootHandle);
-                        eventManager_->dispatchEvent(std::move(sdl_ev), DisplayHandle(rootHandle.getName(), rootHandle.getType()));
+                        eventManager_->dispatchEvent(std::move(sdl_ev), DisplayHandle(rootHandle.getName(), rootHandle.getTypeAtom()));
                     }
 
                 }
 
+                // Dispatch this frame's batch (batched mode only)
+                if (eventManager_)
+                    flushSDLEventBatch_();
+                sdlEventsPolledLastFrame_ = sdlEventsPolled_;
+                sdlEventsDispatchedLastFrame_ = sdlEventsDispatched_;
+                sdlEventsPolled_ = 0;
+                sdlEventsDispatched_ = 0;
+
                 // Flush any events queued programmatically (e.g., unit tests) even
                 // when no real SDL events were polled this frame. This prevents
                 // synthetic motion/click events from stalling until the next real
@@ -814,9 +1091,8 @@ namespace SDOM
                 }
                 
                 // frame timing
-                static Uint64 lastTime = SDL_GetPerformanceCounter();
                 Uint64 currentTime = SDL_GetPerformanceCounter();
-                float fElapsedTime = static_cast<float>(currentTime - lastTime) / SDL_GetPerformanceFrequency();
+                float fElapsedTime = static_cast<float>(currentTime - lastFrameTime_) / SDL_GetPerformanceFrequency();
                 this->fElapsedTime_ = fElapsedTime;
 
                 // update this stage and its children
@@ -840,14 +1116,17 @@ namespace SDOM
                 {
                     SDL_SetRenderTarget(renderer_, nullptr); // Reset to default target
                     SDL_RenderTexture(renderer_, texture_, NULL, NULL);
-                    SDL_RenderPresent(renderer_);
+                    if (headless_)
+                        SDL_FlushRenderer(renderer_);   // resolve into framebuffer_; nothing to present
+                    else
+                        SDL_RenderPresent(renderer_);
                 }
 
                 // Apply any pending configuration requested from other threads
                 applyPendingConfig();                
 
                 // update timing
-                lastTime = currentTime;
+                lastFrameTime_ = currentTime;
 
                 factory_->detachOrphans();          // Detach orphaned display objects
                 factory_->attachFutureChildren();   // Attach future children
@@ -941,7 +1220,7 @@ namespace SDOM
             quitEvent->setRelatedTarget(rootHandle);
 
             // Dispatch via the central dispatch so global events reach both nodes and event-listeners
-            eventManager_->dispatchEvent(std::move(quitEvent), DisplayHandle(rootHandle.getName(), rootHandle.getType()));
+            eventManager_->dispatchEvent(std::move(quitEvent), DisplayHandle(rootHandle.getName(), rootHandle.getTypeAtom()));
         }
 
         // Call recursive quit on the root node (if it exists)
@@ -982,103 +1261,680 @@ namespace SDOM
     } // END: Core::onQuit()
 
     
+    void Core::invalidateRenderList(bool objectsDestroyed)
+    {
+        renderListDirty_ = true;
+        if (objectsDestroyed)
+            renderListUnsafe_ = true;
+        // The hit-test index is keyed by the same hierarchy and sibling order
+        if (eventManager_)
+            eventManager_->invalidateHitTestIndex();
+    } // END: Core::invalidateRenderList()
+
+    void Core::rebuildRenderList_()
+    {
+        // Keep what each surviving node drew last frame so dirty-rect redraw
+        // can tell which regions changed. When pointers may dangle the history
+        // is unusable and the next frame is drawn in full instead.
+        std::unordered_map<IDisplayObject*, RenderListEntry> history;
+        if (dirtyRectRedraw_ && !renderListUnsafe_)
+        {
+            for (const RenderListEntry& entry : renderList_)
+                if (!entry.isExit && entry.drawnValid)
+                    history.emplace(entry.obj, entry);
+        }
+        else if (renderListUnsafe_)
+        {
+            redrawAll_ = true;
+        }
+        // Cache keys are object pointers; they cannot be trusted after destruction
+        if (renderListUnsafe_)
+            releaseSubtreeCaches_();
+
+        renderList_.clear();
+        renderListDirty_ = false;
+        renderListUnsafe_ = false;
+        ++renderListRebuilds_;
+
+        IDisplayObject* activeRoot = dynamic_cast<IDisplayObject*>(rootNode_.get());
+        renderListRoot_ = activeRoot;
+        if (!activeRoot) { return; }
+
+        // Each node emits an enter entry (draw) and an exit entry (OnRender
+        // listeners and focus border) around its children, which reproduces
+        // the pre/post order of a recursive traversal.
+        auto flatten = [this, activeRoot](IDisplayObject& node, bool isChild, auto& self) -> void
+        {
+            const std::size_t enterIndex = renderList_.size();
+            renderList_.push_back({ &node, false, isChild });
+            node.sortByZOrder();
+            for (const auto& child : node.getChildren())
+            {
+                IDisplayObject* childObj = child.get();
+                if (!childObj) continue;
+                // Do not traverse into other Stage subtrees
+                if (dynamic_cast<Stage*>(childObj) && (childObj != activeRoot))
+                    continue;
+                self(*childObj, true, self);
+            }
+            renderList_.push_back({ &node, true, isChild });
+            renderList_[enterIndex].exitIndex = renderList_.size() - 1;
+        };
+        flatten(*activeRoot, false, flatten);
+
+        // Drop subtree caches whose owners left the list or stopped caching
+        for (auto it = subtreeCaches_.begin(); it != subtreeCaches_.end(); )
+        {
+            const bool keep = std::any_of(renderList_.begin(), renderList_.end(),
+                    [obj = it->first](const RenderListEntry& e) { return !e.isExit && e.obj == obj; })
+                && it->first->isCacheAsBitmap();
+            if (keep) { ++it; continue; }
+            texturePool_.release(it->second.lease);
+            it = subtreeCaches_.erase(it);
+        }
+
+        if (!history.empty())
+        {
+            for (RenderListEntry& entry : renderList_)
+            {
+                if (entry.isExit) continue;
+                auto it = history.find(entry.obj);
+                if (it == history.end()) continue;
+                entry.drawnValid = true;
+                entry.focusDrawn = it->second.focusDrawn;
+                entry.drawn = it->second.drawn;
+                history.erase(it);
+            }
+            // Whatever is left was removed, reparented elsewhere or hidden by
+            // a stage switch; its old pixels must be painted over.
+            for (const auto& [obj, entry] : history)
+            {
+                (void)obj;
+                addDamage(entry.drawn);
+            }
+        }
+
+        // sortByZOrder() above may have reordered siblings
+        if (eventManager_)
+            eventManager_->invalidateHitTestIndex();
+    } // END: Core::rebuildRenderList_()
+
     void Core::onRender()
     {
         SDL_Renderer* renderer = getRenderer();
         if (!renderer)
             ERROR("Core::onRender() Error: Renderer is null.");
 
-        // Lambda for recursive render handling using std::function
-        std::function<void(IDisplayObject&)> handleRender;
         SDL_Texture* texture = texture_;
         IDisplayObject* activeRoot = dynamic_cast<IDisplayObject*>(rootNode_.get());
         if (!activeRoot) { return; }
-        handleRender = [this, &handleRender, renderer, texture, activeRoot](IDisplayObject& node) 
+
+        if (renderListRoot_ != activeRoot)
+            redrawAll_ = true;
+        if (renderListDirty_ || renderListRoot_ != activeRoot)
+            rebuildRenderList_();
+
+        // This pass picks up everything dirtied so far; only later setDirty()
+        // calls should keep idle mode awake
+        IDisplayObject::dirtySinceRender_ = false;
+
+        SDL_SetRenderTarget(renderer, nullptr);
+
+        // Clear the entire window to the border color
+        SDL_Color color = getColor();
+        SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
+        SDL_RenderClear(renderer);
+
+        // set the render target to the proper background texture
+        if (texture_)
+            SDL_SetRenderTarget(renderer, texture_); 
+
+        // Decide between a full redraw and clipped passes over damaged rects
+        bool fullRedraw = true;
+        redrawStats_ = RedrawStats{};
+        if (dirtyRectRedraw_ && texture_)
         {
-            // Skip nested Stage subtrees when a different Stage is active.
-            if (dynamic_cast<Stage*>(&node) && (&node != activeRoot))
-                return;
+            collectDamage_();
+            float stageW = 0.0f, stageH = 0.0f;
+            SDL_GetTextureSize(texture_, &stageW, &stageH);
+            fullRedraw = redrawAll_ || damageTarget_ != texture_ || !mergeDamage_(stageW, stageH);
+            damageTarget_ = texture_;
+        }
+        redrawAll_ = false;
+
+        for (RenderListEntry& entry : renderList_)
+            entry.visited = false;
+        computeCullBounds_();
+
+        // Built-in widgets record into the command buffer; it is submitted
+        // (sorted and merged) before any direct SDL drawing and at the end.
+        renderCommands_.begin(renderer, texture_);
+
+        // A pass cut short by an object destroyed mid-traversal may have
+        // recorded commands that reference it; those are dropped, not drawn.
+        setIsTraversing(true);
+        bool complete = true;
+        if (fullRedraw)
+        {
+            damage_.clear();
+            redrawStats_.damagedFraction = 1.0f;
+            complete = renderPass_(nullptr);
+        }
+        else
+        {
+            redrawStats_.fullRedraw = false;
+            redrawStats_.damageRects = static_cast<int>(damage_.size());
+            for (const SDL_FRect& rect : damage_)
+            {
+                renderCommands_.flush();
+                SDL_Rect clip = {
+                    static_cast<int>(rect.x), static_cast<int>(rect.y),
+                    static_cast<int>(rect.w), static_cast<int>(rect.h)
+                };
+                SDL_SetRenderClipRect(renderer, &clip);
+                complete = renderPass_(&rect);
+                if (!complete)
+                    break;
+            }
+            if (complete)
+                renderCommands_.flush();
+            SDL_SetRenderClipRect(renderer, nullptr);
+            damage_.clear();
+        }
+        // Finish the frame over the rebuilt list rather than presenting the
+        // part drawn before the destruction. Each retry is a full pass, since
+        // the damage history died with the old list.
+        for (int retry = 0; !complete && retry < MAX_RENDER_RETRIES; ++retry)
+        {
+            renderCommands_.discard();
+            renderCommands_.setClip(nullptr);
+            SDL_SetRenderClipRect(renderer, nullptr);
+            rebuildRenderList_();
+            redrawAll_ = false;
+            for (RenderListEntry& entry : renderList_)
+                entry.visited = false;
+            computeCullBounds_();
+
+            damage_.clear();
+            redrawStats_ = RedrawStats{};   // describe the pass that completes the frame
+            complete = renderPass_(nullptr);
+        }
+        if (!complete)
+        {
+            renderCommands_.discard();
+            redrawAll_ = true;
+        }
+        renderCommands_.end();
+        setIsTraversing(false);
+        texturePool_.trim();
+
+        // Call the users registered render function if available. 
+        // This is called after the entire scene has been rendered
+        // so the user can overlay additional graphics if desired.
+        if (fnOnRender)
+            fnOnRender();        
+    } // END: Core::onRender()
+
+
+    bool Core::renderPass_(const SDL_FRect* clip)
+    {
+        // Area that can still receive pixels: the stage texture, narrowed by
+        // the damaged rect and then by each clipping ancestor
+        SDL_FRect visible = { -1.0e9f, -1.0e9f, 2.0e9f, 2.0e9f };
+        if (texture_)
+        {
+            float stageW = 0.0f, stageH = 0.0f;
+            SDL_GetTextureSize(texture_, &stageW, &stageH);
+            visible = { 0.0f, 0.0f, stageW, stageH };
+        }
+        if (clip && !SDL_GetRectIntersectionFloat(&visible, clip, &visible))
+            return true;
+        clipStack_.clear();
+        return renderRange_(0, renderList_.size(), visible, clip);
+    } // END: Core::renderPass_()
+
+
+    bool Core::renderRange_(std::size_t begin, std::size_t end, SDL_FRect visible, const SDL_FRect* clip)
+    {
+        // Frames below this belong to an enclosing pass (a cached subtree
+        // is drawn from inside the stage pass). Outside every clipping node
+        // the clip returns to the pass's own area, or is lifted entirely for
+        // an undamaged stage pass.
+        const std::size_t stackBase = clipStack_.size();
+        const bool baseClipped = (clip != nullptr) || renderingCache_;
+
+        auto toClipRect = [](const SDL_FRect& r)
+        {
+            const float x0 = std::floor(r.x), y0 = std::floor(r.y);
+            const float x1 = std::ceil(r.x + r.w), y1 = std::ceil(r.y + r.h);
+            return SDL_Rect{ int(x0), int(y0), int(x1 - x0), int(y1 - y0) };
+        };
+
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            RenderListEntry& entry = renderList_[i];
+            IDisplayObject& node = *entry.obj;
+            // Nested caches are drawn live into the enclosing one
+            const bool cached = !entry.isExit && entry.isChild && !renderingCache_ && node.isCacheAsBitmap();
+
+            // Leaving a clipping node: its children are done, restore the outer clip
+            if (entry.isExit && clipStack_.size() > stackBase && clipStack_.back().exitIndex == i)
+            {
+                visible = clipStack_.back().restore;
+                clipStack_.pop_back();
+                if (clipStack_.size() == stackBase && !baseClipped)
+                {
+                    renderCommands_.setClip(nullptr);
+                }
+                else
+                {
+                    const SDL_Rect r = toClipRect(visible);
+                    renderCommands_.setClip(&r);
+                }
+            }
+
+            if (!entry.isExit)
+                ++redrawStats_.nodesVisited;
+            if (!entry.isExit && entry.isChild)
+            {
+                // Nothing in this subtree can reach a visible pixel
+                if (entry.bounds.w > 0.0f && entry.bounds.h > 0.0f &&
+                    !SDL_HasRectIntersectionFloat(&entry.bounds, &visible))
+                {
+                    redrawStats_.nodesCulled += static_cast<int>((entry.exitIndex - i + 1) / 2);
+                    i = entry.exitIndex;
+                    continue;
+                }
+            }
+
+            // Clipped passes skip nodes that cannot touch the damaged rect
+            if (clip && entry.isChild)
+            {
+                SDL_FRect bounds = { float(node.getX()), float(node.getY()), float(node.getWidth()), float(node.getHeight()) };
+                bounds.x -= DAMAGE_MARGIN;
+                bounds.y -= DAMAGE_MARGIN;
+                bounds.w += DAMAGE_MARGIN * 2.0f;
+                bounds.h += DAMAGE_MARGIN * 2.0f;
+                if (!SDL_HasRectIntersectionFloat(&bounds, clip))
+                {
+                    if (!entry.isExit) ++redrawStats_.nodesSkipped;
+                    if (cached) i = entry.exitIndex;
+                    continue;
+                }
+            }
+
+            // Without a cache texture the subtree is drawn live by this loop
+            const bool drewCache = cached && renderCachedSubtree_(i);
+            if (drewCache)
+                i = entry.exitIndex;
+            else
+                renderEntry_(entry);
+
+            // A listener destroyed display objects; the remaining entries may dangle.
+            if (renderListUnsafe_)
+            {
+                clipStack_.resize(stackBase);
+                redrawAll_ = true;
+                return false;
+            }
+
+            // Entering a clipping node: narrow the clip for its children
+            if (!entry.isExit && !drewCache && entry.isChild && node.isClipChildren() && entry.exitIndex > i + 1)
+            {
+                clipStack_.push_back({ entry.exitIndex, visible });
+                const SDL_FRect own = { float(node.getX()), float(node.getY()), float(node.getWidth()), float(node.getHeight()) };
+                if (!SDL_GetRectIntersectionFloat(&visible, &own, &visible))
+                    visible = { own.x, own.y, 0.0f, 0.0f };
+                const SDL_Rect r = toClipRect(visible);
+                renderCommands_.setClip(&r);
+            }
+        }
+        return true;
+    } // END: Core::renderRange_()
+
+
+    void Core::computeCullBounds_()
+    {
+        // A node's bounds are its own rect united with its children's, cut
+        // back to its own rect when it clips them. Render listeners may draw
+        // anywhere, so their nodes are never culled.
+        const SDL_FRect unbounded = { -1.0e9f, -1.0e9f, 2.0e9f, 2.0e9f };
+        cullStack_.clear();
+        for (std::size_t i = 0; i < renderList_.size(); ++i)
+        {
+            RenderListEntry& entry = renderList_[i];
+            IDisplayObject& node = *entry.obj;
+            auto ownBounds = [&node, &unbounded]() -> SDL_FRect
+            {
+                if (node.hasEventListener(EventType::OnPreRender, false) ||
+                    node.hasEventListener(EventType::OnRender, false))
+                    return unbounded;
+                return { float(node.getX()), float(node.getY()), float(node.getWidth()), float(node.getHeight()) };
+            };
+
+            if (!entry.isExit)
+            {
+                entry.bounds = ownBounds();
+                cullStack_.push_back(i);
+                continue;
+            }
+
+            if (cullStack_.empty()) continue;
+            RenderListEntry& enter = renderList_[cullStack_.back()];
+            cullStack_.pop_back();
+            // Clipped (or cached) descendants never draw outside the node itself
+            if (node.isClipChildren() || node.isCacheAsBitmap())
+                enter.bounds = ownBounds();
+            if (!cullStack_.empty())
+            {
+                RenderListEntry& parent = renderList_[cullStack_.back()];
+                SDL_GetRectUnionFloat(&parent.bounds, &enter.bounds, &parent.bounds);
+            }
+        }
+    } // END: Core::computeCullBounds_()
+
+
+    void Core::renderEntry_(RenderListEntry& entry)
+    {
+        SDL_Renderer* renderer = getRenderer();
+        SDL_Texture* texture = texture_;
+        DisplayHandle rootHandle = this->getStageHandle();
+        Factory& factory = getFactory();
+        IDisplayObject& node = *entry.obj;
+
+        // Listeners run once per frame even when several clipped passes draw the node
+        const bool firstVisit = !entry.visited;
+        entry.visited = true;
+
+        if (!entry.isExit)
+        {
+            // ensure the render target is set correctly before rendering a child
+            if (!renderingCache_ && entry.isChild && texture && SDL_GetRenderTarget(renderer) != texture)
+                SDL_SetRenderTarget(renderer, texture);
+
             // render the node
-            getFactory().start_render_time(&node);
+            if (!node.recordsRenderCommands())
+                renderCommands_.flush();
+            factory.start_render_time(&node);
             node.onRender();
-            getFactory().stop_render_time(&node);
+            factory.stop_render_time(&node);
+            ++redrawStats_.nodesDrawn;
 
             node.setDirty(false); // clear dirty flag after rendering
 
-            DisplayHandle rootHandle = this->getStageHandle();
             // PreRender EventListeners
-            if (node.hasEventListener(EventType::OnPreRender, false))
+            if (firstVisit && node.hasEventListener(EventType::OnPreRender, false))
             {
+                renderCommands_.flush();
                 auto preRenderEv = std::make_unique<Event>(EventType::OnPreRender, rootHandle);
                 preRenderEv->setElapsedTime(this->getElapsedTime());
                 preRenderEv->setRelatedTarget(rootHandle);
-                eventManager_->dispatchEvent(std::move(preRenderEv), DisplayHandle(rootHandle.getName(), rootHandle.getType()));
+                eventManager_->dispatchEvent(std::move(preRenderEv), DisplayHandle(rootHandle.getName(), rootHandle.getTypeAtom()));
             }
 
-            // sort children by z-order if needed
-            node.sortByZOrder();       
+            // Sibling order changed since the list was built; pick it up next frame.
+            if (node.isZOrderDirty())
+                renderListDirty_ = true;
+        }
+        else
+        {
+            // OnRender event listener
+            if (firstVisit && node.hasEventListener(EventType::OnRender, false))
+            {
+                renderCommands_.flush();
+                auto renderEv = std::make_unique<Event>(EventType::OnRender, rootHandle);
+                renderEv->setElapsedTime(this->getElapsedTime());
+                renderEv->setRelatedTarget(rootHandle);
+                eventManager_->dispatchEvent(std::move(renderEv), DisplayHandle(rootHandle.getName(), rootHandle.getTypeAtom()));        
+            }
 
-            // render children
-            for (const auto& child : node.getChildren()) 
+            // Render a border if the child has keyboard focus (never baked into a cache)
+            if (!renderingCache_ && entry.isChild && node.isKeyboardFocused())
             {
-                auto* childObj = dynamic_cast<IDisplayObject*>(child.get());
-                if (childObj) 
+                // properly flash the key focus indication border rectangle
+                SDL_FRect rect = { float(node.getX()), float(node.getY()), float(node.getWidth()), float(node.getHeight()) };
+                SDL_Color focusColor = { (Uint8)keyfocus_gray_, (Uint8)keyfocus_gray_, (Uint8)keyfocus_gray_, 128 }; // Gray color for focus
+                renderCommands_.outlineRect(rect, focusColor);
+            }
+        }
+    } // END: Core::renderEntry_()
+
+
+    bool Core::renderCachedSubtree_(std::size_t enterIndex)
+    {
+        SDL_Renderer* renderer = getRenderer();
+        RenderListEntry& enter = renderList_[enterIndex];
+        const std::size_t exitIndex = enter.exitIndex;
+        IDisplayObject& node = *enter.obj;
+
+        const int x = node.getX();
+        const int y = node.getY();
+        const int w = node.getWidth();
+        const int h = node.getHeight();
+        if (w <= 0 || h <= 0)
+        {
+            renderEntry_(renderList_[exitIndex]);
+            return true;
+        }
+
+        // The cache is painted through a viewport offset by the node's origin,
+        // and a viewport cannot reach left of or above its target's origin: a
+        // node partly off the top or left edge would lose that strip of its
+        // cache. Draw it live there, and repaint the cache once it is back.
+        if (x < 0 || y < 0)
+        {
+            if (auto it = subtreeCaches_.find(&node); it != subtreeCaches_.end())
+                it->second.listVersion = -1;
+            return false;
+        }
+
+        // The cache holds pixels relative to the node, so moving the whole
+        // subtree reuses it; anything dirty, moved or restructured inside
+        // it does not.
+        bool stale = false;
+        std::uint64_t layout = 1469598103934665603ull;
+        auto mix = [&layout](std::int64_t v)
+        {
+            layout ^= static_cast<std::uint64_t>(v);
+            layout *= 1099511628211ull;
+        };
+        for (std::size_t i = enterIndex; i < exitIndex; ++i)
+        {
+            const RenderListEntry& e = renderList_[i];
+            if (e.isExit) continue;
+            if (e.obj->isDirty()) stale = true;
+            mix(e.obj->getX() - x);
+            mix(e.obj->getY() - y);
+            mix(e.obj->getWidth());
+            mix(e.obj->getHeight());
+        }
+
+        // Keeps the pooled texture while the size stays in its bucket; a
+        // different texture (resize, renderer change) must be repainted.
+        SubtreeCache& cache = subtreeCaches_[&node];
+        const std::uint64_t heldId = cache.lease.id;
+        if (!texturePool_.lease(cache.lease, renderer, w, h, SDL_PIXELFORMAT_ARGB8888, false))
+        {
+            // No texture to cache into: the caller draws the subtree live
+            subtreeCaches_.erase(&node);
+            return false;
+        }
+        // Content is blended onto transparent black, so it comes out premultiplied
+        SDL_SetTextureBlendMode(cache.lease.texture, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+        stale = stale || cache.lease.id != heldId
+                      || cache.listVersion != renderListRebuilds_ || cache.layout != layout;
+
+        if (stale)
+        {
+            {
+                // Binds and clears the leased area; restores the previous target
+                TexturePool::Target target(renderer, cache.lease);
+                renderCommands_.setTarget(cache.lease.texture);
+
+                // Offset the viewport so world coordinates land inside the cache
+                const SDL_Rect view = { cache.lease.x - x, cache.lease.y - y, x + w, y + h };
+                const SDL_Rect area = { x, y, w, h };
+                SDL_SetRenderViewport(renderer, &view);
+                SDL_SetRenderClipRect(renderer, &area);
+
+                // Descendants go through the same clipping and culling as the
+                // stage pass, bounded by the cache area
+                renderingCache_ = true;
+                renderEntry_(enter);
+                if (!renderListUnsafe_)
                 {
-                    // Do not traverse into other Stage subtrees
-                    if (dynamic_cast<Stage*>(childObj) && (childObj != activeRoot))
-                        continue;
-                    // ensure the render target is set correctly before rendering
-                    if (texture)
-                        SDL_SetRenderTarget(renderer, texture);
-                    handleRender(*childObj);
-                    // Render a border if the Box has keyboard focus
-                    if (childObj->isKeyboardFocused())
-                    {
-                        // properly flash the key focus indication border rectangle
-                        SDL_FRect rect = { float(childObj->getX()), float(childObj->getY()), float(childObj->getWidth()), float(childObj->getHeight()) };
-                        SDL_Color focusColor = { (Uint8)keyfocus_gray_, (Uint8)keyfocus_gray_, (Uint8)keyfocus_gray_, 128 }; // Gray color for focus
-                        SDL_SetRenderDrawColor(getRenderer(), focusColor.r, focusColor.g, focusColor.b, focusColor.a); // Border color
-                        SDL_RenderRect(getRenderer(), &rect);
-                    }
+                    const SDL_FRect visible = { float(x), float(y), float(w), float(h) };
+                    renderRange_(enterIndex + 1, exitIndex, visible, nullptr);
                 }
+                renderingCache_ = false;
+
+                // Submit while the cache is still bound and offset
+                renderCommands_.setTarget(texture_);
             }
+            if (renderListUnsafe_) return true;
 
-            // OnRender event listener
-            if (node.hasEventListener(EventType::OnRender, false))
+            cache.listVersion = renderListRebuilds_;
+            cache.layout = layout;
+            ++redrawStats_.cacheRebuilds;
+        }
+        else
+        {
+            // Descendants are not reached by any pass this frame
+            redrawStats_.nodesVisited += static_cast<int>((exitIndex - enterIndex - 1) / 2);
+            redrawStats_.nodesSkipped += static_cast<int>((exitIndex - enterIndex) / 2);
+        }
+
+        SDL_FRect dst = { float(x), float(y), float(w), float(h) };
+        SDL_FRect src = cache.lease.srcRect();  // pooled textures may be larger
+        renderCommands_.texturedQuad(cache.lease.texture, &src, dst, SDL_Color{ 255, 255, 255, 255 }, SDL_SCALEMODE_NEAREST);
+        ++redrawStats_.cachedSubtrees;
+
+        // Focus borders pulse every frame, so they are drawn over the cache
+        for (std::size_t i = enterIndex + 1; i < exitIndex; ++i)
+        {
+            const RenderListEntry& e = renderList_[i];
+            if (!e.isExit || !e.obj->isKeyboardFocused()) continue;
+            SDL_FRect rect = { float(e.obj->getX()), float(e.obj->getY()), float(e.obj->getWidth()), float(e.obj->getHeight()) };
+            SDL_Color focusColor = { (Uint8)keyfocus_gray_, (Uint8)keyfocus_gray_, (Uint8)keyfocus_gray_, 128 };
+            renderCommands_.outlineRect(rect, focusColor);
+        }
+
+        renderEntry_(renderList_[exitIndex]);
+        return true;
+    } // END: Core::renderCachedSubtree_()
+
+
+    void Core::releaseSubtreeCaches_()
+    {
+        for (auto& [obj, cache] : subtreeCaches_)
+        {
+            (void)obj;
+            texturePool_.release(cache.lease);
+        }
+        subtreeCaches_.clear();
+    } // END: Core::releaseSubtreeCaches_()
+
+
+    void Core::collectDamage_()
+    {
+        for (RenderListEntry& entry : renderList_)
+        {
+            if (entry.isExit) continue;
+            IDisplayObject& node = *entry.obj;
+
+            const SDL_FRect now = { float(node.getX()), float(node.getY()), float(node.getWidth()), float(node.getHeight()) };
+            const bool focused = entry.isChild && node.isKeyboardFocused();
+            const bool moved = !entry.drawnValid ||
+                now.x != entry.drawn.x || now.y != entry.drawn.y ||
+                now.w != entry.drawn.w || now.h != entry.drawn.h;
+
+            // The focus border flashes every frame; render listeners may draw anything
+            const bool changed = moved || node.isDirty() || focused || entry.focusDrawn ||
+                node.hasEventListener(EventType::OnPreRender, false) ||
+                node.hasEventListener(EventType::OnRender, false);
+
+            if (changed)
             {
-                auto renderEv = std::make_unique<Event>(EventType::OnRender, rootHandle);
-                renderEv->setElapsedTime(this->getElapsedTime());
-                renderEv->setRelatedTarget(rootHandle);
-                eventManager_->dispatchEvent(std::move(renderEv), DisplayHandle(rootHandle.getName(), rootHandle.getType()));        
+                if (entry.drawnValid && moved)
+                    addDamage(entry.drawn);
+                addDamage(now);
             }
-        };
 
-        SDL_SetRenderTarget(renderer, nullptr);
+            entry.drawn = now;
+            entry.drawnValid = true;
+            entry.focusDrawn = focused;
+        }
+    } // END: Core::collectDamage_()
 
-        // Clear the entire window to the border color
-        SDL_Color color = getColor();
-        SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
-        SDL_RenderClear(renderer);
 
-        // set the render target to the proper background texture
-        if (texture_)
-            SDL_SetRenderTarget(renderer, texture_); 
+    bool Core::mergeDamage_(float stageW, float stageH)
+    {
+        if (stageW <= 0.0f || stageH <= 0.0f) return false;
+        const SDL_FRect stage = { 0.0f, 0.0f, stageW, stageH };
 
-        // Call recursive render on the root node (if it exists)
-        IDisplayObject* rootObj = dynamic_cast<IDisplayObject*>(rootNode_.get());
-        if (rootObj)
+        // Clip to the stage and snap outward to whole pixels so the clip
+        // rects used for the passes cover every touched pixel.
+        std::vector<SDL_FRect> rects;
+        rects.reserve(damage_.size());
+        for (const SDL_FRect& r : damage_)
         {
-            setIsTraversing(true);
-            handleRender(*rootObj);
-            setIsTraversing(false);
+            SDL_FRect c;
+            if (!SDL_GetRectIntersectionFloat(&r, &stage, &c)) continue;
+            const float x0 = std::floor(c.x), y0 = std::floor(c.y);
+            const float x1 = std::ceil(c.x + c.w), y1 = std::ceil(c.y + c.h);
+            rects.push_back({ x0, y0, x1 - x0, y1 - y0 });
         }
 
-        // Call the users registered render function if available. 
-        // This is called after the entire scene has been rendered
-        // so the user can overlay additional graphics if desired.
-        if (fnOnRender)
-            fnOnRender();        
-    } // END: Core::onRender()
+        // Too many scattered rects: one bounding rect is cheaper than many passes
+        auto collapse = [&rects]()
+        {
+            SDL_FRect u = rects.front();
+            for (const SDL_FRect& r : rects) SDL_GetRectUnionFloat(&u, &r, &u);
+            rects.assign(1, u);
+        };
+        if (rects.size() > MAX_DAMAGE_RECTS * 8)
+            collapse();
+
+        // Fold overlapping rects together until none intersect
+        bool merged = true;
+        while (merged)
+        {
+            merged = false;
+            for (std::size_t i = 0; i < rects.size() && !merged; ++i)
+            {
+                for (std::size_t j = i + 1; j < rects.size(); ++j)
+                {
+                    if (!SDL_HasRectIntersectionFloat(&rects[i], &rects[j])) continue;
+                    SDL_GetRectUnionFloat(&rects[i], &rects[j], &rects[i]);
+                    rects.erase(rects.begin() + static_cast<std::ptrdiff_t>(j));
+                    merged = true;
+                    break;
+                }
+            }
+        }
+        if (rects.size() > MAX_DAMAGE_RECTS)
+            collapse();
+
+        float area = 0.0f;
+        for (const SDL_FRect& r : rects) area += r.w * r.h;
+        redrawStats_.damagedFraction = area / (stageW * stageH);
+        damage_.swap(rects);
+        return redrawStats_.damagedFraction <= dirtyRectThreshold_;
+    } // END: Core::mergeDamage_()
+
+
+    void Core::addDamage(const SDL_FRect& worldRect)
+    {
+        if (!dirtyRectRedraw_ || worldRect.w < 0.0f || worldRect.h < 0.0f) return;
+        damage_.push_back({ worldRect.x - DAMAGE_MARGIN, worldRect.y - DAMAGE_MARGIN,
+                            worldRect.w + DAMAGE_MARGIN * 2.0f, worldRect.h + DAMAGE_MARGIN * 2.0f });
+    } // END: Core::addDamage()
+
+
+    void Core::setDirtyRectThreshold(float fraction)
+    {
+        dirtyRectThreshold_ = std::clamp(fraction, 0.0f, 1.0f);
+    } // END: Core::setDirtyRectThreshold()
 
 
     void Core::onEvent(Event& event)
@@ -2132,6 +2988,33 @@ namespace SDOM
         }
     }
 
+    void Core::flushSDLEventBatch_()
+    {
+        if (sdlEventBatch_.empty() || !eventManager_)
+            return;
+
+        // Queue the batch (each event is still hit-tested as it is queued) and
+        // drain the queue once. Keyboard events pick their target from the focus
+        // at queue time, so a TAB/ESC shortcut drains what is queued up to and
+        // including itself and moves focus before the next event is queued,
+        // exactly as the unbatched path does.
+        for (SDL_Event& ev : sdlEventBatch_)
+        {
+            eventManager_->Queue_SDL_Event(ev);
+            if (ev.type == SDL_EVENT_KEY_DOWN && (ev.key.key == SDLK_TAB || ev.key.key == SDLK_ESCAPE))
+            {
+                eventManager_->DispatchQueuedEvents();
+                handleImmediateShortcuts(ev);
+            }
+        }
+        eventManager_->DispatchQueuedEvents();
+
+        for (const SDL_Event& ev : sdlEventBatch_)
+            dispatchRawEventToRoot(ev);
+        sdlEventsDispatched_ += static_cast<int>(sdlEventBatch_.size());
+        sdlEventBatch_.clear();
+    }
+
     void Core::dispatchRawEventToRoot(const SDL_Event& event)
     {
         if (!eventManager_ || !rootNode_)
@@ -2144,12 +3027,12 @@ namespace SDOM
         auto onEvent = std::make_unique<Event>(EventType::OnEvent, rootHandle);
         onEvent->setSDL_Event(event);
         onEvent->setRelatedTarget(rootHandle);
-        eventManager_->dispatchEvent(std::move(onEvent), DisplayHandle(rootHandle.getName(), rootHandle.getType()));
+        eventManager_->dispatchEvent(std::move(onEvent), DisplayHandle(rootHandle.getName(), rootHandle.getTypeAtom()));
 
         auto rawEvent = std::make_unique<Event>(EventType::SDL_Event, rootHandle);
         rawEvent->setSDL_Event(event);
         rawEvent->setRelatedTarget(rootHandle);
-        eventManager_->dispatchEvent(std::move(rawEvent), DisplayHandle(rootHandle.getName(), rootHandle.getType()));
+        eventManager_->dispatchEvent(std::move(rawEvent), DisplayHandle(rootHandle.getName(), rootHandle.getTypeAtom()));
     }
 
     bool Core::pumpSingleSDLEvent(SDL_Event& eventOut)
@@ -2535,7 +3418,10 @@ namespace SDOM
 
         SDL_SetRenderTarget(renderer_, nullptr);
         SDL_RenderTexture(renderer_, texture_, nullptr, nullptr);
-        SDL_RenderPresent(renderer_);
+        if (headless_)
+            SDL_FlushRenderer(renderer_);
+        else
+            SDL_RenderPresent(renderer_);
 
         applyPendingConfig();
         if (factory_)
@@ -65,6 +65,7 @@ SDOM::Core::CoreConfig toCoreConfig(const SDOM_CoreConfig* cfg)
     out.windowFlags = cfg->windowFlags;
     out.pixelFormat = cfg->pixelFormat;
     out.color = cfg->color;
+    out.headless = cfg->headless != 0;
     return out;
 }
 
@@ -81,6 +82,7 @@ void copyCoreConfig(const SDOM::Core::CoreConfig& src, SDOM_CoreConfig& dst)
     dst.windowFlags = src.windowFlags;
     dst.pixelFormat = src.pixelFormat;
     dst.color = src.color;
+    dst.headless = src.headless ? 1 : 0;
 }
 
 bool variantToDisplayHandle(const SDOM_Variant* handle,
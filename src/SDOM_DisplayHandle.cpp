@@ -27,27 +27,47 @@ namespace SDOM
     {
         if (!factory_) return nullptr;
 
-        if (id_ != 0) {
-            DisplayHandle resolved = factory_->resolveDisplayHandleById(id_);
-            if (resolved.getId() != 0) {
-                if (name_.empty()) {
-                    const_cast<DisplayHandle*>(this)->name_ = resolved.getName();
-                }
-                if (type_.empty()) {
-                    const_cast<DisplayHandle*>(this)->type_ = resolved.getType();
-                }
-                const_cast<DisplayHandle*>(this)->id_ = resolved.getId();
-                if (auto* ptr = factory_->getDisplayObjectPtr(resolved.getName())) {
-                    return ptr;
-                }
-            }
+        // Name-only handles look the name up once and cache the slot id
+        if (id_ == 0) {
+            if (name_.empty()) return nullptr;
+            resolveId_();
+            if (id_ == 0) return nullptr;
         }
 
-        if (!name_.empty()) {
-            return factory_->getDisplayObjectPtr(name_);
+        // O(1) generational slot lookup; a stale id (destroyed object) is a miss
+        IDisplayObject* ptr = factory_->resolveDisplayObjectPtr(id_);
+
+        // A handle addressed by name follows the name to a recreated object
+        if (!ptr && byName_) {
+            const_cast<DisplayHandle*>(this)->id_ = 0;
+            resolveId_();
+            if (id_ == 0) return nullptr;
+            ptr = factory_->resolveDisplayObjectPtr(id_);
+        }
+
+        if (ptr && name_.empty()) {
+            const_cast<DisplayHandle*>(this)->name_ = ptr->getName();
+            const_cast<DisplayHandle*>(this)->type_ = ptr->getTypeAtom();
         }
+        return ptr;
+    }
 
-        return nullptr;
+    void DisplayHandle::resolveId_() const
+    {
+        if (id_ != 0 || name_.empty() || !factory_) return;
+        DisplayHandle* self = const_cast<DisplayHandle*>(this);
+        self->id_ = factory_->getDisplayObjectId(name_);
+        self->byName_ = true;
+    }
+
+    bool DisplayHandle::operator==(const DisplayHandle& other) const
+    {
+        resolveId_();
+        other.resolveId_();
+        if (id_ != 0 && other.id_ != 0) 
+            return id_ == other.id_;
+        // Neither side maps to a live object; fall back to the name metadata
+        return id_ == other.id_ && name_ == other.name_;
     }
 
     void DisplayHandle::registerBindingsImpl(const std::string& typeName)
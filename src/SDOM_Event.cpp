@@ -56,6 +56,8 @@
 #include <string_view>
 #include <cstdint>
 #include <cstring>
+#include <atomic>
+#include <vector>
 // #include <SDOM/SDOM_CAPI_Events_runtime.h>
 
 
@@ -235,12 +237,103 @@ namespace SDOM
         }
     } // namespace
 
+    // ------------------ //
+    // --- Event Pool --- //
+    // ------------------ //
+
+    namespace 
+    {
+        constexpr std::size_t EVENT_POOL_MAX_FREE_BLOCKS = 4096;
+
+        std::atomic<uint64_t> s_eventHeapAllocations{0};
+        std::atomic<uint64_t> s_eventPoolReuses{0};
+        std::atomic<uint64_t> s_eventsLive{0};
+
+        // Each thread recycles into its own free list, so posting events from
+        // worker threads never contends with the main loop. Blocks released on
+        // another thread simply migrate to that thread's list. The flag is
+        // trivially destructible, so it stays readable during thread teardown.
+        thread_local bool t_eventCacheDestroyed = false;
+
+        struct EventBlockCache
+        {
+            std::vector<void*> blocks;
+            EventBlockCache() { blocks.reserve(EVENT_POOL_MAX_FREE_BLOCKS); }
+            ~EventBlockCache()
+            {
+                t_eventCacheDestroyed = true;
+                for (void* block : blocks)
+                    ::operator delete(block);
+            }
+        };
+
+        EventBlockCache* eventCache()
+        {
+            if (t_eventCacheDestroyed) return nullptr;
+            thread_local EventBlockCache t_cache;
+            return &t_cache;
+        }
+    } // anonymous namespace
+
+    void* SDOM::Event::operator new(std::size_t size)
+    {
+        s_eventsLive.fetch_add(1, std::memory_order_relaxed);
+        if (size == sizeof(Event))
+        {
+            EventBlockCache* cache = eventCache();
+            if (cache && !cache->blocks.empty())
+            {
+                void* block = cache->blocks.back();
+                cache->blocks.pop_back();
+                s_eventPoolReuses.fetch_add(1, std::memory_order_relaxed);
+                return block;
+            }
+        }
+        s_eventHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+        return ::operator new(size);
+    }
+
+    void SDOM::Event::operator delete(void* ptr, std::size_t size) noexcept
+    {
+        if (!ptr) return;
+        s_eventsLive.fetch_sub(1, std::memory_order_relaxed);
+        if (size == sizeof(Event))
+        {
+            EventBlockCache* cache = eventCache();
+            if (cache && cache->blocks.size() < EVENT_POOL_MAX_FREE_BLOCKS)
+            {
+                cache->blocks.push_back(ptr);
+                return;
+            }
+        }
+        ::operator delete(ptr);
+    }
+
+    SDOM::Event::PoolStats SDOM::Event::getPoolStats()
+    {
+        PoolStats stats;
+        stats.heapAllocations = s_eventHeapAllocations.load(std::memory_order_relaxed);
+        stats.poolReuses = s_eventPoolReuses.load(std::memory_order_relaxed);
+        stats.live = s_eventsLive.load(std::memory_order_relaxed);
+        EventBlockCache* cache = eventCache();
+        stats.freeBlocks = cache ? cache->blocks.size() : 0;
+        return stats;
+    }
+
+    void SDOM::Event::trimPool()
+    {
+        EventBlockCache* cache = eventCache();
+        if (!cache) return;
+        for (void* block : cache->blocks)
+            ::operator delete(block);
+        cache->blocks.clear();
+    }
+
     SDOM::Event::Event(EventType type, DisplayHandle target, float fElapsedTime)
         : type(type),
           target(target),
           current_phase(Phase::Capture),
-          elapsed_time(fElapsedTime),
-          payload_(nlohmann::json::object())
+          elapsed_time(fElapsedTime)
     {
         // Constructor implementation
         use_capture = true; // Default to using capture phase
@@ -275,6 +368,7 @@ namespace SDOM
 
     EventType Event::getType() const                { std::lock_guard<std::mutex> lock(event_mutex_); return type; }
     std::string Event::getTypeName() const          { std::lock_guard<std::mutex> lock(event_mutex_); return type.getName(); }
+    EventType::IdType Event::getTypeId() const      { std::lock_guard<std::mutex> lock(event_mutex_); return type.getId(); }
 
     Event::Phase Event::getPhase() const            { std::lock_guard<std::mutex> lock(event_mutex_); return current_phase; }
     Event& Event::setPhase(Event::Phase phase)      { std::lock_guard<std::mutex> lock(event_mutex_); current_phase = phase; return *this; }
@@ -329,8 +423,10 @@ namespace SDOM
     // ------------------------------ //
 
     const nlohmann::json& Event::getPayload() const {
+        static const nlohmann::json s_emptyPayload = nlohmann::json::object();
         std::lock_guard<std::mutex> lock(event_mutex_);
-        return payload_;
+        // The payload is left null until custom data is stored (avoids an allocation per event)
+        return payload_.is_null() ? s_emptyPayload : payload_;
     }
 
     Event& Event::setPayload(const nlohmann::json& j) {
@@ -350,6 +446,7 @@ namespace SDOM
 
     std::string Event::getPayloadString() const {
         std::lock_guard<std::mutex> lock(event_mutex_);
+        if (payload_.is_null()) return "{}";
         return payload_.dump();
     }
 
@@ -387,6 +484,23 @@ namespace SDOM
     }
 
 
+    // --------------------------- //
+    // --- Typed Input Payload --- //
+    // --------------------------- //
+
+    Event::InputPayload Event::getInputPayload() const
+    {
+        std::lock_guard lock(event_mutex_);
+        return input_;
+    }
+
+    Event& Event::setInputPayload(const InputPayload& input)
+    {
+        std::lock_guard lock(event_mutex_);
+        input_ = input;
+        return *this;
+    }
+
     // ------------------------------ //
     // --- Mouse Event Properties --- //
     // ------------------------------ //
@@ -394,90 +508,78 @@ namespace SDOM
     float Event::getMouseX() const
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) return 0.0f;
-        return payload_.value("mouse_x", 0.0f);
+        return input_.mouseX;
     }
 
     Event& Event::setMouseX(float x)
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) payload_ = nlohmann::json::object();
-        payload_["mouse_x"] = x;
+        input_.mouseX = x;
         return *this;
     }
 
     float Event::getMouseY() const
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) return 0.0f;
-        return payload_.value("mouse_y", 0.0f);
+        return input_.mouseY;
     }
 
     Event& Event::setMouseY(float y)
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) payload_ = nlohmann::json::object();
-        payload_["mouse_y"] = y;
+        input_.mouseY = y;
         return *this;
     }
 
     float Event::getWheelX() const
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) return 0.0f;
-        return payload_.value("wheel_x", 0.0f);
+        return input_.wheelX;
     }
 
     Event& Event::setWheelX(float x)
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) payload_ = nlohmann::json::object();
-        payload_["wheel_x"] = x;
+        input_.wheelX = x;
         return *this;
     }
 
     float Event::getWheelY() const
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) return 0.0f;
-        return payload_.value("wheel_y", 0.0f);
+        return input_.wheelY;
     }
 
     Event& Event::setWheelY(float y)
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) payload_ = nlohmann::json::object();
-        payload_["wheel_y"] = y;
+        input_.wheelY = y;
         return *this;
     }
 
     float Event::getDragOffsetX() const
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) return 0.0f;
-        return payload_.value("drag_offset_x", 0.0f);
+        return input_.dragOffsetX;
     }
 
     Event& Event::setDragOffsetX(float v)
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) payload_ = nlohmann::json::object();
-        payload_["drag_offset_x"] = v;
+        input_.dragOffsetX = v;
         return *this;
     }
 
     float Event::getDragOffsetY() const
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) return 0.0f;
-        return payload_.value("drag_offset_y", 0.0f);
+        return input_.dragOffsetY;
     }
 
     Event& Event::setDragOffsetY(float v)
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) payload_ = nlohmann::json::object();
-        payload_["drag_offset_y"] = v;
+        input_.dragOffsetY = v;
         return *this;
     }
 
@@ -489,30 +591,26 @@ namespace SDOM
     int Event::getClickCount() const
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) return 0;
-        return payload_.value("click_count", 0);
+        return input_.clickCount;
     }
 
     Event& Event::setClickCount(int c)
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) payload_ = nlohmann::json::object();
-        payload_["click_count"] = c;
+        input_.clickCount = c;
         return *this;
     }
 
     uint8_t Event::getButton() const
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) return 0u;
-        return static_cast<uint8_t>(payload_.value("button", 0));
+        return input_.button;
     }
 
     Event& Event::setButton(uint8_t b)
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) payload_ = nlohmann::json::object();
-        payload_["button"] = b;
+        input_.button = b;
         return *this;
     }
 
@@ -520,60 +618,52 @@ namespace SDOM
     SDL_Scancode Event::getScanCode() const
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) return SDL_SCANCODE_UNKNOWN;
-        return static_cast<SDL_Scancode>(payload_.value("scancode", static_cast<int>(SDL_SCANCODE_UNKNOWN)));
+        return input_.scancode;
     }
 
     Event& Event::setScanCode(SDL_Scancode sc)
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) payload_ = nlohmann::json::object();
-        payload_["scancode"] = static_cast<int>(sc);
+        input_.scancode = sc;
         return *this;
     }
 
     SDL_Keycode Event::getKeycode() const
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) return SDLK_UNKNOWN;
-        return static_cast<SDL_Keycode>(payload_.value("keycode", static_cast<int>(SDLK_UNKNOWN)));
+        return input_.keycode;
     }
 
     Event& Event::setKeycode(SDL_Keycode kc)
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) payload_ = nlohmann::json::object();
-        payload_["keycode"] = static_cast<int>(kc);
+        input_.keycode = kc;
         return *this;
     }
 
     Uint16 Event::getKeymod() const
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) return 0;
-        return static_cast<Uint16>(payload_.value("keymod", 0));
+        return input_.keymod;
     }
 
     Event& Event::setKeymod(Uint16 km)
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) payload_ = nlohmann::json::object();
-        payload_["keymod"] = km;
+        input_.keymod = km;
         return *this;
     }
 
     int Event::getAsciiCode() const
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) return 0;
-        return payload_.value("ascii_code", 0);
+        return input_.asciiCode;
     }
 
     Event& Event::setAsciiCode(int a)
     {
         std::lock_guard lock(event_mutex_);
-        if (!payload_.is_object()) payload_ = nlohmann::json::object();
-        payload_["ascii_code"] = a;
+        input_.asciiCode = a;
         return *this;
     }
 
@@ -45,6 +45,8 @@
 #include <SDOM/SDOM_IDisplayObject.hpp>
 
 #include <SDOM/SDOM_DisplayHandle.hpp>
+#include <cstring>
+#include <SDOM/CAPI/SDOM_CAPI_EventQueue.h>
 
 namespace SDOM 
 {
@@ -148,18 +150,70 @@ namespace SDOM
 
     bool EventManager::hasListeners(const EventType& type) const
     {
-        // Fast path: if no objects exist, trivially false
-        const auto names = getFactory().getDisplayObjectNames();
-        for (const auto& name : names)
-        {
-            auto handle = getFactory().getDisplayObject(name);
-            if (!handle) continue;
-            auto* obj = dynamic_cast<IDisplayObject*>(handle.get());
-            if (!obj) continue;
-            if (obj->hasEventListener(type, /*useCapture*/true) || obj->hasEventListener(type, /*useCapture*/false))
-                return true;
+        auto it = listenerIndex_.find(type);
+        return it != listenerIndex_.end() && !it->second.empty();
+    }
+
+    void EventManager::addListenerSubscription(const EventType& type, IDisplayObject* obj, int count)
+    {
+        if (!obj || count <= 0) return;
+        ListenerSubscription& sub = listenerIndex_[type][obj];
+        if (sub.count == 0)
+            sub.generation = ++listenerGeneration_;
+        sub.count += count;
+    }
+
+    void EventManager::removeListenerSubscription(const EventType& type, IDisplayObject* obj, int count)
+    {
+        if (!obj || count <= 0) return;
+        auto it = listenerIndex_.find(type);
+        if (it == listenerIndex_.end()) return;
+        auto sub = it->second.find(obj);
+        if (sub == it->second.end()) return;
+        sub->second.count -= count;
+        if (sub->second.count <= 0)
+            it->second.erase(sub);
+        if (it->second.empty())
+            listenerIndex_.erase(it);
+    }
+
+    namespace 
+    {
+        // Common interactive widgets whose default onEvent handlers rely on
+        // hover state, plus the simple containers used by the examples.
+        bool isHoverSensitiveType(Atom type)
+        {
+            static const std::unordered_set<Atom> hover_types = {
+                Atom("Button"), Atom("IconButton"), Atom("ArrowButton"),
+                Atom("CheckButton"), Atom("RadioButton"), Atom("TristateButton"),
+                Atom("Slider"), Atom("ScrollBar"),
+                Atom("Box"), Atom("Frame")
+            };
+            return hover_types.find(type) != hover_types.end();
+        }
+    } // anonymous namespace
+
+    void EventManager::trackDisplayObject(IDisplayObject* obj)
+    {
+        if (!obj) return;
+        if (isHoverSensitiveType(obj->getTypeAtom()))
+            hoverCandidates_.insert(obj);
+        else
+            hoverCandidates_.erase(obj);
+    }
+
+    void EventManager::forgetDisplayObject(IDisplayObject* obj)
+    {
+        if (!obj) return;
+        hoverCandidates_.erase(obj);
+        for (auto it = listenerIndex_.begin(); it != listenerIndex_.end(); )
+        {
+            it->second.erase(obj);
+            if (it->second.empty())
+                it = listenerIndex_.erase(it);
+            else
+                ++it;
         }
-        return false;
     }
 
     bool EventManager::should_emit_hover_events() const
@@ -169,23 +223,9 @@ namespace SDOM
             return true;
         // Heuristic: if common hover-sensitive UI types are present, keep
         // emitting hover so default onEvent handlers can update state.
-        static const std::unordered_set<std::string> hover_types = {
-            // Common interactive widgets that rely on hover state
-            "Button", "IconButton", "ArrowButton",
-            "CheckButton", "RadioButton", "TristateButton",
-            "Slider", "ScrollBar",
-            // Test scaffolds / simple containers used in examples
-            "Box", "Frame"
-        };
-        const auto names = getFactory().getDisplayObjectNames();
-        for (const auto& name : names)
-        {
-            auto handle = getFactory().getDisplayObject(name);
-            auto* obj = handle ? dynamic_cast<IDisplayObject*>(handle.get()) : nullptr;
-            if (!obj) continue;
-            if (obj->isHidden()) continue;
-            if (!obj->isEnabled()) continue;
-            if (hover_types.find(obj->getType()) != hover_types.end())
+        for (const IDisplayObject* obj : hoverCandidates_)
+        {
+            if (!obj->isHidden() && obj->isEnabled())
                 return true;
         }
         return false;
@@ -193,10 +233,13 @@ namespace SDOM
 
     void EventManager::DispatchQueuedEvents() 
     {
+        // Pull in events posted from other threads first
+        drainPostedEvents_();
         // Ensure any coalesced events are emitted before dispatching
         flushCoalesced_();
         DisplayHandle rootNode = getFactory().getStageHandle();
         if (!rootNode) { return; }
+        static const Atom stageType("Stage");
         while (auto event = takeNextEvent()) 
         {
             DisplayHandle object = event->getTarget();
@@ -205,7 +248,7 @@ namespace SDOM
             {
                 // Deliver if target is the stage itself, a descendant of the stage,
                 // or if the event type is marked global.
-                if (object->getType() == "Stage" || event->getType().getGlobal())
+                if (object->getTypeAtom() == stageType || event->getType().getGlobal())
                 {
                     deliver = true;
                 }
@@ -265,6 +308,106 @@ namespace SDOM
         return evt;
     }
 
+    EventManager::~EventManager()
+    {
+        PostedEvent posted;
+        while (postQueue_.tryPop(posted))
+            releasePosted_(posted);
+    }
+
+    bool EventManager::postEvent(std::unique_ptr<Event> event)
+    {
+        if (!event) return false;
+        PostedEvent posted;
+        posted.event = event.get();
+        if (!postQueue_.tryPush(posted))
+        {
+            postRejected_.fetch_add(1, std::memory_order_relaxed);
+            return false;   // unique_ptr still owns and discards the event
+        }
+        event.release();
+        postAccepted_.fetch_add(1, std::memory_order_relaxed);
+        Core::getInstance().wakeFromIdle();
+        return true;
+    }
+
+    bool EventManager::postEvent(uint32_t typeId, uint64_t targetId, const char* payloadJson)
+    {
+        if (typeId == 0) return false;
+        PostedEvent posted;
+        posted.typeId = typeId;
+        posted.targetId = targetId;
+        if (payloadJson)
+        {
+            const std::size_t len = std::strlen(payloadJson);
+            posted.payloadJson = new char[len + 1];
+            std::memcpy(posted.payloadJson, payloadJson, len + 1);
+        }
+        if (!postQueue_.tryPush(posted))
+        {
+            releasePosted_(posted);
+            postRejected_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        postAccepted_.fetch_add(1, std::memory_order_relaxed);
+        Core::getInstance().wakeFromIdle();
+        return true;
+    }
+
+    EventManager::PostQueueStats EventManager::getPostQueueStats() const
+    {
+        PostQueueStats stats;
+        stats.posted = postAccepted_.load(std::memory_order_relaxed);
+        stats.rejected = postRejected_.load(std::memory_order_relaxed);
+        stats.drained = postDrained_.load(std::memory_order_relaxed);
+        stats.highWater = postHighWater_.load(std::memory_order_relaxed);
+        stats.capacity = postQueue_.capacity();
+        return stats;
+    }
+
+    void EventManager::releasePosted_(PostedEvent& posted)
+    {
+        delete posted.event;
+        delete[] posted.payloadJson;
+        posted = PostedEvent{};
+    }
+
+    void EventManager::drainPostedEvents_()
+    {
+        std::size_t batch = 0;
+        PostedEvent posted;
+        while (postQueue_.tryPop(posted))
+        {
+            ++batch;
+            std::unique_ptr<Event> event(posted.event);
+            posted.event = nullptr;
+            if (!event)
+            {
+                // Id-based post: resolve type and target on the main thread
+                EventType* type = EventType::fromId(posted.typeId);
+                if (type)
+                {
+                    DisplayHandle target = posted.targetId 
+                        ? getFactory().resolveDisplayHandleById(posted.targetId) 
+                        : getFactory().getStageHandle();
+                    if (target)
+                    {
+                        event = std::make_unique<Event>(*type, target, getCore().getElapsedTime());
+                        if (posted.payloadJson)
+                            event->setPayloadString(posted.payloadJson);
+                    }
+                }
+            }
+            releasePosted_(posted);
+            if (event)
+                addEvent(std::move(event));
+        }
+        if (batch == 0) return;
+        postDrained_.fetch_add(batch, std::memory_order_relaxed);
+        if (batch > postHighWater_.load(std::memory_order_relaxed))
+            postHighWater_.store(batch, std::memory_order_relaxed);
+    }
+
     // Emit all coalesced events into the real queue (FIFO order not guaranteed
     // across different types; map order is acceptable for metered events).
     void EventManager::flushCoalesced_()
@@ -466,15 +609,27 @@ namespace SDOM
 
     void EventManager::dispatchEventToAllEventListenersGlobally(std::unique_ptr<Event> event) 
     {
-        std::vector<std::string> names = getFactory().getDisplayObjectNames();
-        for (const auto& name : names) 
+        auto it = listenerIndex_.find(event->getType());
+        if (it == listenerIndex_.end()) return;
+
+        // Snapshot subscribers: listeners may add/remove listeners or destroy objects.
+        std::vector<std::pair<IDisplayObject*, uint64_t>> subscribers;
+        subscribers.reserve(it->second.size());
+        for (const auto& kv : it->second)
+            subscribers.emplace_back(kv.first, kv.second.generation);
+
+        const EventType type = event->getType();
+        for (const auto& [obj, generation] : subscribers) 
         {
-            auto obj = getFactory().getDisplayObject(name);
-            if (obj) 
-            {
-                Event evnt = *event;
-                obj->triggerEventListeners(evnt, false);
-            }
+            // Skip objects that unsubscribed or were destroyed during this dispatch,
+            // including a new object that reused a destroyed one's address
+            auto current = listenerIndex_.find(type);
+            if (current == listenerIndex_.end()) break;
+            auto sub = current->second.find(obj);
+            if (sub == current->second.end() || sub->second.generation != generation) continue;
+
+            Event evnt = *event;
+            obj->triggerEventListeners(evnt, false);
         }
     }
 
@@ -502,6 +657,13 @@ namespace SDOM
 
     DisplayHandle EventManager::findTopObjectUnderMouse(DisplayHandle rootNode, DisplayHandle excludeNode) const 
     {
+        if (hitIndexEnabled_)
+        {
+            DisplayHandle hit = queryHitIndex_(rootNode.get(), static_cast<int>(Stage::mouseX), static_cast<int>(Stage::mouseY),
+                                               excludeNode, /*clickableOnly*/true, /*pruneHidden*/true);
+            return hit ? hit : rootNode;
+        }
+
         DisplayHandle targetHandle; // Reset target handle
         int maxDepth = -1;      // Track the maximum depth of the target node
         int maxZ = std::numeric_limits<int>::min();
@@ -559,6 +721,13 @@ namespace SDOM
     // the top-most object under the mouse. Useful for hover/scroll targeting.
     DisplayHandle EventManager::findTopObjectUnderMouseForHover(DisplayHandle rootNode, DisplayHandle excludeNode) const 
     {
+        if (hitIndexEnabled_)
+        {
+            DisplayHandle hit = queryHitIndex_(rootNode.get(), static_cast<int>(Stage::mouseX), static_cast<int>(Stage::mouseY),
+                                               excludeNode, /*clickableOnly*/false, /*pruneHidden*/true);
+            return hit ? hit : rootNode;
+        }
+
         DisplayHandle targetHandle; // Reset target handle
         int maxDepth = -1;      // Track the maximum depth of the target node
         int maxZ = std::numeric_limits<int>::min();
@@ -668,9 +837,17 @@ namespace SDOM
                 self(child, depth + 1, self);
         };
 
-        getCore().setIsTraversing(true);
-        traverse(rootNode, 0, traverse);
-        getCore().setIsTraversing(false);
+        if (hitIndexEnabled_)
+        {
+            targetHandle = queryHitIndex_(rootNode.get(), static_cast<int>(px), static_cast<int>(py),
+                                          excludeNode, clickableOnly, /*pruneHidden*/false);
+        }
+        else
+        {
+            getCore().setIsTraversing(true);
+            traverse(rootNode, 0, traverse);
+            getCore().setIsTraversing(false);
+        }
 
         if (!targetHandle)
         {
@@ -710,6 +887,202 @@ namespace SDOM
     }
 
 
+    // --- Hit-Test Spatial Index ------------------------------------------------------------
+    // Candidates come from the grid cell under the point plus the oversized list.
+    // The winner is the lexicographic maximum of (z-order, depth, pre-order
+    // sequence), which is exactly what the recursive resolvers compute.
+
+    void EventManager::markHitBoundsDirty(IDisplayObject* obj)
+    {
+        if (!obj || hitIndexDirty_ || hitEntries_.empty()) return;
+        // Off-stage churn with no queries in between: a rebuild is cheaper
+        if (hitBoundsDirty_.size() > hitEntries_.size())
+        {
+            hitBoundsDirty_.clear();
+            hitIndexDirty_ = true;
+            return;
+        }
+        hitBoundsDirty_.push_back(obj);
+    }
+
+    void EventManager::refreshHitIndex_(IDisplayObject* root) const
+    {
+        if (hitIndexDirty_ || root != hitIndexRoot_)
+        {
+            rebuildHitIndex_(root);
+            return;
+        }
+        for (IDisplayObject* obj : hitBoundsDirty_)
+        {
+            auto it = hitEntryOf_.find(obj);
+            if (it == hitEntryOf_.end()) continue;
+            if (it->second == 0)
+            {
+                // The root's rect defines the grid layout
+                rebuildHitIndex_(root);
+                return;
+            }
+            unbinHitEntry_(it->second);
+            binHitEntry_(it->second);
+        }
+        hitBoundsDirty_.clear();
+    }
+
+    void EventManager::rebuildHitIndex_(IDisplayObject* root) const
+    {
+        hitEntries_.clear();
+        hitEntryOf_.clear();
+        hitGridCells_.clear();
+        hitOversized_.clear();
+        hitBoundsDirty_.clear();
+        hitIndexRoot_ = root;
+        hitIndexDirty_ = false;
+        hitGridCols_ = hitGridRows_ = 0;
+        if (!root) return;
+
+        auto collect = [&](IDisplayObject* obj, const DisplayHandle& handle, int parent, int depth, auto& self) -> void
+        {
+            const int index = static_cast<int>(hitEntries_.size());
+            HitEntry entry;
+            entry.obj = obj;
+            entry.handle = handle;
+            entry.parent = parent;
+            entry.depth = depth;
+            entry.seq = index;
+            hitEntries_.push_back(std::move(entry));
+            hitEntryOf_[obj] = index;
+            for (const auto& child : obj->getChildren())
+            {
+                IDisplayObject* childObj = child.get();
+                if (!childObj || hitEntryOf_.count(childObj)) continue;
+                self(childObj, child, index, depth + 1, self);
+            }
+            hitEntries_[index].seqEnd = static_cast<int>(hitEntries_.size()) - 1;
+        };
+        DisplayHandle rootHandle(root->getName(), root->getTypeAtom());
+        collect(root, rootHandle, -1, 0, collect);
+
+        hitGridOriginX_ = root->getX();
+        hitGridOriginY_ = root->getY();
+        hitGridCols_ = std::max(1, (root->getWidth() + HIT_GRID_CELL_SIZE - 1) / HIT_GRID_CELL_SIZE);
+        hitGridRows_ = std::max(1, (root->getHeight() + HIT_GRID_CELL_SIZE - 1) / HIT_GRID_CELL_SIZE);
+        hitGridCells_.resize(static_cast<size_t>(hitGridCols_) * static_cast<size_t>(hitGridRows_));
+
+        for (int i = 0; i < static_cast<int>(hitEntries_.size()); ++i)
+            binHitEntry_(i);
+    }
+
+    void EventManager::binHitEntry_(int index) const
+    {
+        HitEntry& entry = hitEntries_[index];
+        IDisplayObject* obj = entry.obj;
+        entry.rect = { obj->getX(), obj->getY(), obj->getWidth(), obj->getHeight() };
+        entry.oversized = false;
+        entry.cellX0 = entry.cellY0 = 0;
+        entry.cellX1 = entry.cellY1 = -1;
+        if (entry.rect.w <= 0 || entry.rect.h <= 0) return; // can never contain a point
+
+        // Rects outside the grid clamp to the border cells, as do query points.
+        auto cellX = [&](int x) { return std::clamp((x - hitGridOriginX_) / HIT_GRID_CELL_SIZE, 0, hitGridCols_ - 1); };
+        auto cellY = [&](int y) { return std::clamp((y - hitGridOriginY_) / HIT_GRID_CELL_SIZE, 0, hitGridRows_ - 1); };
+        entry.cellX0 = cellX(entry.rect.x);
+        entry.cellY0 = cellY(entry.rect.y);
+        entry.cellX1 = cellX(entry.rect.x + entry.rect.w - 1);
+        entry.cellY1 = cellY(entry.rect.y + entry.rect.h - 1);
+
+        const int cells = (entry.cellX1 - entry.cellX0 + 1) * (entry.cellY1 - entry.cellY0 + 1);
+        if (cells > HIT_GRID_MAX_CELLS_PER_ENTRY)
+        {
+            entry.oversized = true;
+            hitOversized_.push_back(index);
+            return;
+        }
+        for (int cy = entry.cellY0; cy <= entry.cellY1; ++cy)
+            for (int cx = entry.cellX0; cx <= entry.cellX1; ++cx)
+                hitGridCells_[cy * hitGridCols_ + cx].push_back(index);
+    }
+
+    void EventManager::unbinHitEntry_(int index) const
+    {
+        HitEntry& entry = hitEntries_[index];
+        auto eraseFrom = [index](std::vector<int>& bucket)
+        {
+            bucket.erase(std::remove(bucket.begin(), bucket.end(), index), bucket.end());
+        };
+        if (entry.oversized)
+        {
+            eraseFrom(hitOversized_);
+            entry.oversized = false;
+            return;
+        }
+        for (int cy = entry.cellY0; cy <= entry.cellY1; ++cy)
+            for (int cx = entry.cellX0; cx <= entry.cellX1; ++cx)
+                eraseFrom(hitGridCells_[cy * hitGridCols_ + cx]);
+    }
+
+    DisplayHandle EventManager::queryHitIndex_(IDisplayObject* root, int px, int py, const DisplayHandle& excludeNode,
+                                               bool clickableOnly, bool pruneHidden) const
+    {
+        refreshHitIndex_(root);
+        if (hitEntries_.empty() || hitGridCells_.empty()) 
+            return DisplayHandle();
+
+        // The excluded node removes its whole subtree, i.e. a contiguous pre-order range
+        int excludeFirst = 0, excludeLast = -1;
+        if (IDisplayObject* excluded = excludeNode.get())
+        {
+            auto it = hitEntryOf_.find(excluded);
+            if (it != hitEntryOf_.end())
+            {
+                excludeFirst = hitEntries_[it->second].seq;
+                excludeLast = hitEntries_[it->second].seqEnd;
+            }
+        }
+
+        const SDL_Point point{ px, py };
+        int best = -1;
+        int bestZ = 0;
+        auto consider = [&](int index)
+        {
+            const HitEntry& entry = hitEntries_[index];
+            if (entry.seq >= excludeFirst && entry.seq <= excludeLast) return;
+            IDisplayObject* obj = entry.obj;
+            if (obj->isHidden()) return;
+            if (clickableOnly && !obj->isClickable()) return;
+            if (!SDL_PointInRect(&point, &entry.rect)) return;
+            if (pruneHidden)
+            {
+                for (int a = entry.parent; a >= 0; a = hitEntries_[a].parent)
+                    if (hitEntries_[a].obj->isHidden()) return;
+            }
+            const int z = obj->getZOrder();
+            bool take = false;
+            if (best < 0) take = true;
+            else if (z > bestZ) take = true;
+            else if (z == bestZ)
+            {
+                const HitEntry& current = hitEntries_[best];
+                if (entry.depth > current.depth) take = true;
+                else if (entry.depth == current.depth && entry.seq > current.seq) take = true;
+            }
+            if (take)
+            {
+                best = index;
+                bestZ = z;
+            }
+        };
+
+        const int cx = std::clamp((px - hitGridOriginX_) / HIT_GRID_CELL_SIZE, 0, hitGridCols_ - 1);
+        const int cy = std::clamp((py - hitGridOriginY_) / HIT_GRID_CELL_SIZE, 0, hitGridRows_ - 1);
+        for (int index : hitGridCells_[cy * hitGridCols_ + cx])
+            consider(index);
+        for (int index : hitOversized_)
+            consider(index);
+
+        return best >= 0 ? hitEntries_[best].handle : DisplayHandle();
+    } // END: queryHitIndex_()
+
+
     // --- preprocessSDLEvent: Normalize coordinates and sync stage mouse position ------------
     // ⚙️ System Behavior:
     // Converts window coordinates into renderer logical coordinates, sets the stage’s
@@ -1171,6 +1544,14 @@ namespace SDOM
     // window focus changes without motion, preventing "stuck hover" states.
     void EventManager::onFrameTick()
     {
+        // Roll the event pool counters over to the frame that just finished
+        const Event::PoolStats stats = Event::getPoolStats();
+        const uint64_t created = stats.heapAllocations + stats.poolReuses;
+        eventHeapAllocsLastFrame_ = stats.heapAllocations - eventHeapAllocsMark_;
+        eventsCreatedLastFrame_ = created - eventsCreatedMark_;
+        eventHeapAllocsMark_ = stats.heapAllocations;
+        eventsCreatedMark_ = created;
+
         if (hover_watch_target_) {
             ++hover_idle_frames_;
             constexpr int kHoverLeaveFrameLimit = 250;
@@ -1379,6 +1760,62 @@ namespace SDOM
     // 3. Identify top object under cursor
     // 4. Route event by category
     // 5. Run system-level updates (hover, window enter/leave, dragging)
+    const EventType* EventManager::eventTypeForSDL(Uint32 sdlType)
+    {
+        switch (sdlType)
+        {
+            case SDL_EVENT_MOUSE_MOTION:        return &EventType::MouseMove;
+            case SDL_EVENT_MOUSE_WHEEL:         return &EventType::MouseWheel;
+            case SDL_EVENT_MOUSE_BUTTON_DOWN:   return &EventType::MouseButtonDown;
+            case SDL_EVENT_MOUSE_BUTTON_UP:     return &EventType::MouseButtonUp;
+            case SDL_EVENT_KEY_DOWN:            return &EventType::KeyDown;
+            case SDL_EVENT_KEY_UP:              return &EventType::KeyUp;
+            case SDL_EVENT_TEXT_INPUT:          return &EventType::TextInput;
+            case SDL_EVENT_WINDOW_RESIZED:      return &EventType::Resize;
+            case SDL_EVENT_WINDOW_MOVED:        return &EventType::Move;
+            case SDL_EVENT_QUIT:                return &EventType::Quit;
+            default:                            return nullptr;
+        }
+    }
+
+    bool EventManager::batchSDL_Event(std::vector<SDL_Event>& batch, const SDL_Event& sdlEvent)
+    {
+        const EventType* type = eventTypeForSDL(sdlEvent.type);
+        const bool coalesce = type && type->getBatchPolicy() == EventType::BatchPolicy::Coalesce
+                              && type->getCoalesceStrategy() != EventType::CoalesceStrategy::None;
+
+        // Only merge with the immediately preceding event so ordering relative to
+        // clicks, keys, etc. is preserved.
+        if (!coalesce || batch.empty() || batch.back().type != sdlEvent.type)
+        {
+            batch.push_back(sdlEvent);
+            return false;
+        }
+
+        SDL_Event& prev = batch.back();
+        if (sdlEvent.type == SDL_EVENT_MOUSE_WHEEL 
+            && type->getCoalesceStrategy() == EventType::CoalesceStrategy::Sum)
+        {
+            // Accumulate wheel deltas; keep the latest cursor position
+            prev.wheel.x += sdlEvent.wheel.x;
+            prev.wheel.y += sdlEvent.wheel.y;
+            prev.wheel.mouse_x = sdlEvent.wheel.mouse_x;
+            prev.wheel.mouse_y = sdlEvent.wheel.mouse_y;
+            prev.wheel.timestamp = sdlEvent.wheel.timestamp;
+            return true;
+        }
+
+        // Last-wins; motion keeps the accumulated relative movement
+        SDL_Event merged = sdlEvent;
+        if (sdlEvent.type == SDL_EVENT_MOUSE_MOTION)
+        {
+            merged.motion.xrel += prev.motion.xrel;
+            merged.motion.yrel += prev.motion.yrel;
+        }
+        prev = merged;
+        return true;
+    }
+
     void EventManager::Queue_SDL_Event(SDL_Event& sdlEvent)
     {
         DisplayHandle node = getStageHandle();
@@ -1578,3 +2015,34 @@ namespace SDOM
 
 
 } // namespace SDOM
+
+
+// --- Cross-thread posting C API (hand-written; see SDOM_CAPI_EventQueue.h) --- //
+// Reads the EventManager pointer through Core::PostGuard instead of the callable
+// registry so worker threads never contend on its lock. Core waits for callers
+// counted in by a guard before it destroys the EventManager.
+
+extern "C" {
+
+bool SDOM_PostEvent(SDOM_EventType type, uint64_t target_id, const char* payload_json)
+{
+    SDOM::Core::PostGuard guard;
+    if (!guard.get()) return false;
+    return guard.get()->postEvent(static_cast<uint32_t>(type), target_id, payload_json);
+}
+
+bool SDOM_GetEventQueueStats(SDOM_EventQueueStats* out_stats)
+{
+    SDOM::Core::PostGuard guard;
+    SDOM::EventManager* em = guard.get();
+    if (!out_stats || !em) return false;
+    const SDOM::EventManager::PostQueueStats stats = em->getPostQueueStats();
+    out_stats->posted = stats.posted;
+    out_stats->rejected = stats.rejected;
+    out_stats->drained = stats.drained;
+    out_stats->highWater = static_cast<uint64_t>(stats.highWater);
+    out_stats->capacity = static_cast<uint64_t>(stats.capacity);
+    return true;
+}
+
+} // extern "C"
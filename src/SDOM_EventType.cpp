@@ -82,8 +82,17 @@ namespace SDOM
         // Fast path
         if (id_ != 0) { return id_; }
 
+        // Instances constructed by name after the canonical one (e.g. EventType("None"))
+        // share the canonical id so id comparisons agree with name comparisons.
+        auto reg = registry.find(name.str());
+        if (reg != registry.end() && reg->second != this && reg->second->id_ != 0)
+        {
+            id_ = reg->second->id_;
+            return id_;
+        }
+
         // Determine category index (stable per-run based on first-seen order)
-        std::string cat = category_.empty() ? std::string("Uncategorized") : category_;
+        std::string cat = category_.empty() ? std::string("Uncategorized") : category_.str();
         unsigned cidx = getOrAssignCategoryIndex(cat);
 
         // allocate local id atomically for this category
@@ -150,6 +159,10 @@ namespace SDOM
     //   - coalesce_key:
     //       * Global: single slot for the type (last-wins/sum across all targets)
     //       * ByTarget: one slot per target (for target-sensitive metering)
+    //   - batch_policy (only when Core batches SDL events once per frame):
+    //       * Fidelity:  every raw SDL event is kept and dispatched in order
+    //       * Coalesce:  consecutive raw events merge via coalesce_strategy
+    //       * Immediate: pending batch is flushed and the event dispatched at once
     //
     //              // captures, bubbles, target, global
     // 🚫 Untestable ---------------------------------------------------------------
@@ -305,21 +318,25 @@ namespace SDOM
         // Metered (10 ms default via SDOM_EVENT_METER_MS_DEFAULT):
         EventType::MouseMove
             .setMeterEnabled(true)
+            .setBatchPolicy(EventType::BatchPolicy::Coalesce)
             .setCoalesceStrategy(EventType::CoalesceStrategy::Last)
             .setCoalesceKey(EventType::CoalesceKey::Global);
 
         EventType::MouseWheel
             .setMeterEnabled(true)
+            .setBatchPolicy(EventType::BatchPolicy::Coalesce)
             .setCoalesceStrategy(EventType::CoalesceStrategy::Sum)
             .setCoalesceKey(EventType::CoalesceKey::Global);
 
         EventType::Resize
             .setMeterEnabled(true)
+            .setBatchPolicy(EventType::BatchPolicy::Coalesce)
             .setCoalesceStrategy(EventType::CoalesceStrategy::Last)
             .setCoalesceKey(EventType::CoalesceKey::Global);
 
         EventType::Move
             .setMeterEnabled(true)
+            .setBatchPolicy(EventType::BatchPolicy::Coalesce)
             .setCoalesceStrategy(EventType::CoalesceStrategy::Last)
             .setCoalesceKey(EventType::CoalesceKey::Global);
 
@@ -377,12 +394,14 @@ namespace SDOM
     uint16_t EventType::getMeterIntervalMs() const { return meter_interval_ms_; }
     EventType::CoalesceStrategy EventType::getCoalesceStrategy() const { return coalesce_strategy_; }
     EventType::CoalesceKey EventType::getCoalesceKey() const { return coalesce_key_; }
+    EventType::BatchPolicy EventType::getBatchPolicy() const { return batch_policy_; }
 
     EventType& EventType::setCritical(bool critical) { critical_ = critical; return *this; }
     EventType& EventType::setMeterEnabled(bool enabled) { meter_enabled_ = enabled; return *this; }
     EventType& EventType::setMeterIntervalMs(uint16_t ms) { meter_interval_ms_ = ms; return *this; }
     EventType& EventType::setCoalesceStrategy(CoalesceStrategy s) { coalesce_strategy_ = s; return *this; }
     EventType& EventType::setCoalesceKey(CoalesceKey k) { coalesce_key_ = k; return *this; }
+    EventType& EventType::setBatchPolicy(BatchPolicy p) { batch_policy_ = p; return *this; }
 
     // -- lookup helpers --
     std::vector<EventType*> EventType::getAll()
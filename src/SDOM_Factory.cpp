@@ -82,7 +82,9 @@ namespace SDOM
         // register the Stage
         registerDisplayObjectType("Stage", TypeCreators{
             Stage::CreateFromInitStruct, 
-            Stage::CreateFromJson
+            Stage::CreateFromJson,
+            sizeof(Stage),
+            ParseInitStruct<Stage>
         });
 
         // register the Texture asset
@@ -237,7 +239,9 @@ namespace SDOM
         // register the Label display object
         registerDisplayObjectType("Label", TypeCreators{
             Label::CreateFromInitStruct_Base,   // InitStruct path
-            Label::CreateFromJson               // JSON path
+            Label::CreateFromJson,              // JSON path
+            sizeof(Label),
+            ParseInitStruct<Label>
         });
 
         // --- Register the IPanelObject Decendants --- //
@@ -245,68 +249,90 @@ namespace SDOM
         // register Frame
         registerDisplayObjectType("Frame", TypeCreators{
             Frame::CreateFromInitStruct,
-            Frame::CreateFromJson 
+            Frame::CreateFromJson,
+            sizeof(Frame),
+            ParseInitStruct<Frame>
         });
 
         // register Button
         registerDisplayObjectType("Button", TypeCreators{
             Button::CreateFromInitStruct,   // C++ / InitStruct path
-            Button::CreateFromJson          // JSON loader path
+            Button::CreateFromJson,         // JSON loader path
+            sizeof(Button),
+            ParseInitStruct<Button>
         });
 
         // register Group
         registerDisplayObjectType("Group", TypeCreators{
             Group::CreateFromInitStruct,   // JSON → InitStruct → Group
-            Group::CreateFromJson          // InitStruct → Group
+            Group::CreateFromJson,         // InitStruct → Group
+            sizeof(Group),
+            ParseInitStruct<Group>
         });
 
         // register the IconButton
         registerDisplayObjectType("IconButton", TypeCreators{
             IconButton::CreateFromInitStruct,
-            IconButton::CreateFromJson
+            IconButton::CreateFromJson,
+            sizeof(IconButton),
+            ParseInitStruct<IconButton>
         });
 
         // register the ArrowButton
         registerDisplayObjectType("ArrowButton", TypeCreators{
             ArrowButton::CreateFromInitStruct,
-            ArrowButton::CreateFromJson
+            ArrowButton::CreateFromJson,
+            sizeof(ArrowButton),
+            ParseInitStruct<ArrowButton>
         });
 
         // register the TristateButton
         registerDisplayObjectType("TristateButton", TypeCreators{
             TristateButton::CreateFromInitStruct,
-            TristateButton::CreateFromJson
+            TristateButton::CreateFromJson,
+            sizeof(TristateButton),
+            ParseInitStruct<TristateButton>
         });
 
         // register CheckButton
         registerDisplayObjectType("CheckButton", TypeCreators{
             CheckButton::CreateFromInitStruct,
-            CheckButton::CreateFromJson
+            CheckButton::CreateFromJson,
+            sizeof(CheckButton),
+            ParseInitStruct<CheckButton>
         });
 
         // register RadioButton
         registerDisplayObjectType("RadioButton", TypeCreators{
             RadioButton::CreateFromInitStruct,
-            RadioButton::CreateFromJson
+            RadioButton::CreateFromJson,
+            sizeof(RadioButton),
+            ParseInitStruct<RadioButton>
         });
 
 
         // register the Slider
         registerDisplayObjectType("Slider", TypeCreators{
             Slider::CreateFromInitStruct,
-            Slider::CreateFromJson
+            Slider::CreateFromJson,
+            sizeof(Slider),
+            ParseInitStruct<Slider>
         });
 
         // register the ProgressBar
         registerDisplayObjectType("ProgressBar", TypeCreators{
             ProgressBar::CreateFromInitStruct,
-            ProgressBar::CreateFromJson
+            ProgressBar::CreateFromJson,
+            sizeof(ProgressBar),
+            ParseInitStruct<ProgressBar>
         });
 
         // register the ScrollBar
         registerDisplayObjectType("ScrollBar", TypeCreators{
             ScrollBar::CreateFromInitStruct,
-            ScrollBar::CreateFromJson
+            ScrollBar::CreateFromJson,
+            sizeof(ScrollBar),
+            ParseInitStruct<ScrollBar>
         });
 
 #if defined(SDOM_ENABLE_RUNTIME_BINDING_EXPORT)
@@ -332,72 +358,59 @@ namespace SDOM
     void Factory::collectGarbage()
     {
         constexpr bool SHOW_DEBUG = false;
-        // Get the current list of orphaned display objects
-        std::vector<DisplayHandle> orphanList_ = getOrphanedDisplayObjects();
-
-        if (orphanList_.empty()) 
-        {
-            // No orphans to collect
+        if (orphanQueue_.empty())
             return;
-        }
-
-        // Default grace period for GracePeriod policy (ms). Adjust or make configurable if desired.
-        constexpr auto defaultGrace = std::chrono::milliseconds(ORPHAN_GRACE_PERIOD);
-        auto now = std::chrono::steady_clock::now();
 
-        // Collect names to destroy to avoid mutating registries while iterating
-        std::vector<std::string> toDestroy;
-        if (SHOW_DEBUG) std::cout << "Factory::collectGarbage: " << orphanList_.size() << " orphan(s) found\n";
+        const auto now = std::chrono::steady_clock::now();
+        const auto deadline = now + gcBudget_;
+        int destroyed = 0;
 
-        for (const auto& orphan : orphanList_) 
+        while (!orphanQueue_.empty() && orphanQueue_.front().due <= now)
         {
-            if (!orphan || !orphan.get()) continue;
+            // Always make progress, then honor the time slice
+            if (destroyed > 0 && std::chrono::steady_clock::now() >= deadline)
+            {
+                if (SHOW_DEBUG) std::cout << "Factory::collectGarbage: budget spent after " << destroyed << " object(s)\n";
+                break;
+            }
 
-            // IDisplayObject is friend of Factory so we can access its internals if needed.
-            IDisplayObject* obj = dynamic_cast<IDisplayObject*>(orphan.get());
-            if (!obj) continue;
+            std::pop_heap(orphanQueue_.begin(), orphanQueue_.end(), std::greater<OrphanEntry>());
+            const OrphanEntry entry = orphanQueue_.back();
+            orphanQueue_.pop_back();
 
-            auto policy = obj->getOrphanRetentionPolicy();
-            switch (policy) 
+            // Stale: adopted, re-orphaned or destroyed since this entry was queued
+            auto it = orphans_.find(entry.obj);
+            if (it == orphans_.end() || it->second != entry.ticket)
+                continue;
+
+            IDisplayObject* obj = entry.obj;
+            switch (obj->getOrphanRetentionPolicy())
             {
                 case IDisplayObject::OrphanRetentionPolicy::AutoDestroy:
-                    if (SHOW_DEBUG) std::cout << "  AutoDestroy -> scheduling: " << orphan.getName() << " (type=" << orphan->getType() << ")\n";
-                    toDestroy.push_back(orphan.getName());
                     break;
 
-                case IDisplayObject::OrphanRetentionPolicy::GracePeriod: 
+                case IDisplayObject::OrphanRetentionPolicy::GracePeriod:
                 {
-                    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - obj->orphanedAt_);
-                    auto until = obj->getOrphanGrace();
-                    if (elapsed >= until) 
-                    {
-                        if (SHOW_DEBUG) std::cout << "  GracePeriod expired (" << elapsed.count() << "ms) -> scheduling: " << orphan.getName() << "\n";
-                        toDestroy.push_back(orphan.getName());
-                    }
-                    else 
+                    // The grace may have been extended after the entry was queued
+                    auto due = obj->orphanedAt_ + obj->getOrphanGrace();
+                    if (due > now)
                     {
-                        if (SHOW_DEBUG) std::cout << "  GracePeriod active (" << elapsed.count() << "ms) -> retaining: " << orphan.getName() << "\n";
+                        if (SHOW_DEBUG) std::cout << "  GracePeriod active -> retaining: " << obj->getName() << "\n";
+                        pushOrphan_(obj, entry.ticket);
+                        continue;
                     }
                     break;
                 }
 
                 case IDisplayObject::OrphanRetentionPolicy::RetainUntilManual:
                 default:
-                    if (SHOW_DEBUG) std::cout << "  RetainUntilManual -> keeping: " << orphan.getName() << "\n";
-                    break;
+                    if (SHOW_DEBUG) std::cout << "  RetainUntilManual -> keeping: " << obj->getName() << "\n";
+                    continue;
             }
-        }
 
-        if (toDestroy.empty()) 
-        {
-            if (SHOW_DEBUG) std::cout << "No orphaned objects eligible for destruction at this time.\n";
-            return;
-        }
-
-        for (const auto& name : toDestroy) 
-        {
-            if (SHOW_DEBUG) std::cout << "Destroying orphaned DisplayHandle: " << name << "\n";
-            destroyDisplayObject(name);
+            if (SHOW_DEBUG) std::cout << "Destroying orphaned DisplayHandle: " << obj->getName() << "\n";
+            destroyDisplayObject(obj->getName());
+            ++destroyed;
         }
     } // end:   void Factory::collectGarbage()
 
@@ -405,7 +418,7 @@ namespace SDOM
     
     void Factory::registerDisplayObjectType(const std::string& typeName, const TypeCreators& creators)
     {
-        creators_[typeName] = creators;
+        creators_[Atom(typeName)] = creators;
 
         try
         {
@@ -458,6 +471,32 @@ namespace SDOM
     }
 
 
+    bool Factory::reserveDisplayObjects(const std::string& typeName, std::size_t count)
+    {
+        auto it = findCreators_(typeName);
+        if (it == creators_.end() || it->second.objectSize == 0)
+        {
+            DEBUG_LOG("Factory::reserveDisplayObjects: no objectSize registered for type '" + typeName + "'");
+            return false;
+        }
+        SlabPool::displayObjects().reserve(it->second.objectSize, count);
+        return true;
+    } // END: Factory::reserveDisplayObjects()
+
+    SlabPool::Stats Factory::getDisplayObjectPoolStats(const std::string& typeName) const
+    {
+        auto it = findCreators_(typeName);
+        if (it == creators_.end() || it->second.objectSize == 0)
+            return SlabPool::Stats{};
+        // Types of equal size share a class, so these counts may include them
+        return SlabPool::displayObjects().getStats(it->second.objectSize);
+    } // END: Factory::getDisplayObjectPoolStats(typeName)
+
+    SlabPool::Stats Factory::getDisplayObjectPoolStats() const
+    {
+        return SlabPool::displayObjects().getStats();
+    } // END: Factory::getDisplayObjectPoolStats()
+
     IDisplayObject* Factory::getDisplayObjectPtr(const std::string& name)
     {
         auto it = displayObjects_.find(name);
@@ -518,51 +557,117 @@ namespace SDOM
         return resolveAssetObject(id);
     }
 
+    IDisplayObject* Factory::resolveDisplayObjectPtr(uint64_t id) const
+    {
+        const uint32_t generation = static_cast<uint32_t>(id >> 32);
+        const uint32_t index = static_cast<uint32_t>(id & 0xFFFFFFFFu);
+        if (generation == 0) return nullptr;
+        const uint32_t page = index / DISPLAY_SLOT_PAGE_SIZE;
+        if (page >= DISPLAY_SLOT_MAX_PAGES) return nullptr;
+        DisplaySlot* slots = displaySlotPages_[page].load(std::memory_order_acquire);
+        if (!slots) return nullptr;
+        const DisplaySlot& slot = slots[index % DISPLAY_SLOT_PAGE_SIZE];
+        if (slot.generation.load(std::memory_order_acquire) != generation) return nullptr;
+        IDisplayObject* obj = slot.obj.load(std::memory_order_acquire);
+        // Seqlock-style re-check: if the slot was released (and maybe reused)
+        // between the two loads, the generation has moved on and obj is not ours
+        if (slot.generation.load(std::memory_order_acquire) != generation) return nullptr;
+        return obj;
+    }
+
+    uint64_t Factory::getDisplayObjectId(const std::string& name) const
+    {
+        auto it = displayObjects_.find(name);
+        if (it != displayObjects_.end() && it->second) 
+            return it->second->id;
+        return 0;
+    }
+
     // ID registry helpers
     uint64_t Factory::registerDisplayObject(const std::string& name, DisplayHandle handle)
     {
         auto it = displayObjects_.find(name);
-        if (it != displayObjects_.end()) {
-            uint64_t existing = it->second->id;
-            if (existing != 0) {
-                // Already has an id; ensure mapping exists
-                {
-                    std::shared_lock<std::shared_mutex> rlock(id_map_mutex_);
-                    auto found = display_id_map_.find(existing);
-                    if (found != display_id_map_.end()) {
-                        handle.setId(existing);
-                        return existing;
-                    }
-                }
-                // Recreate the mapping if it was missing
-                std::unique_lock<std::shared_mutex> lock(id_map_mutex_);
-                handle.setId(existing);
-                display_id_map_[existing] = handle;
-                return existing;
-            }
+        if (it == displayObjects_.end() || !it->second || !it->second->obj) 
+        {
+            ERROR("Factory::registerDisplayObject: no display object named '" + name + "'");
+            return 0;
         }
-        uint64_t id = next_object_id_.fetch_add(1);
+        IDisplayObject* obj = it->second->obj.get();
+
+        // Already registered; keep the existing id while it still maps to this object
+        uint64_t existing = it->second->id;
+        if (existing != 0 && resolveDisplayObjectPtr(existing) == obj) 
         {
-            std::unique_lock<std::shared_mutex> lock(id_map_mutex_);
-            handle.setId(id);
-            display_id_map_[id] = handle;
+            handle.setId(existing);
+            return existing;
         }
-        if (it != displayObjects_.end()) it->second->id = id;
+
+        std::lock_guard<std::mutex> lock(displaySlotMutex_);
+        uint64_t id = acquireDisplaySlot_(obj);
+        handle.setId(id);
+        it->second->id = id;
         return id;
     }
 
+    // Caller holds displaySlotMutex_
+    uint64_t Factory::acquireDisplaySlot_(IDisplayObject* obj)
+    {
+        uint32_t index = 0;
+        if (!freeDisplaySlots_.empty()) 
+        {
+            index = freeDisplaySlots_.back();
+            freeDisplaySlots_.pop_back();
+        } 
+        else 
+        {
+            index = displaySlotCount_;
+            const uint32_t page = index / DISPLAY_SLOT_PAGE_SIZE;
+            if (page >= DISPLAY_SLOT_MAX_PAGES) 
+            {
+                ERROR("Factory::registerDisplayObject: display slot capacity exhausted");
+                return 0;
+            }
+            if (!displaySlotPages_[page].load(std::memory_order_relaxed)) 
+                addDisplaySlotPage_(page);
+            ++displaySlotCount_;
+        }
+
+        DisplaySlot& slot = displaySlotPages_[index / DISPLAY_SLOT_PAGE_SIZE]
+            .load(std::memory_order_relaxed)[index % DISPLAY_SLOT_PAGE_SIZE];
+        slot.obj.store(obj, std::memory_order_release);
+        const uint32_t generation = slot.generation.load(std::memory_order_relaxed);
+        return (static_cast<uint64_t>(generation) << 32) | index;
+    }
+
+    // Caller holds displaySlotMutex_
+    void Factory::addDisplaySlotPage_(uint32_t page)
+    {
+        displaySlotStorage_.push_back(std::make_unique<DisplaySlot[]>(DISPLAY_SLOT_PAGE_SIZE));
+        displaySlotPages_[page].store(displaySlotStorage_.back().get(), std::memory_order_release);
+    }
+
     DisplayHandle Factory::resolveDisplayObject(uint64_t id) const
     {
-        std::shared_lock<std::shared_mutex> lock(id_map_mutex_);
-        auto it = display_id_map_.find(id);
-        if (it != display_id_map_.end()) return it->second;
+        IDisplayObject* obj = resolveDisplayObjectPtr(id);
+        if (obj) return DisplayHandle(obj->getName(), obj->getTypeAtom(), id);
         return DisplayHandle();
     }
 
     void Factory::unregisterDisplayObject(uint64_t id)
     {
-        std::unique_lock<std::shared_mutex> lock(id_map_mutex_);
-        display_id_map_.erase(id);
+        const uint32_t generation = static_cast<uint32_t>(id >> 32);
+        const uint32_t index = static_cast<uint32_t>(id & 0xFFFFFFFFu);
+        std::lock_guard<std::mutex> lock(displaySlotMutex_);
+        if (generation == 0 || index >= displaySlotCount_) return;
+        DisplaySlot& slot = displaySlotPages_[index / DISPLAY_SLOT_PAGE_SIZE]
+            .load(std::memory_order_relaxed)[index % DISPLAY_SLOT_PAGE_SIZE];
+        if (slot.generation.load(std::memory_order_relaxed) != generation) return;
+
+        slot.obj.store(nullptr, std::memory_order_release);
+        uint32_t next = generation + 1;
+        if (next == 0) next = 1;    // 0 is reserved for "no id"
+        slot.generation.store(next, std::memory_order_release);
+        freeDisplaySlots_.push_back(index);
     }
 
     uint64_t Factory::registerAssetObject(const std::string& name, AssetHandle handle)
@@ -623,16 +728,18 @@ namespace SDOM
     DisplayHandle Factory::createDisplayObject(const std::string& typeName,
                                 const IDisplayObject::InitStruct& init)
     {
-        auto it = creators_.find(typeName);
+        auto it = findCreators_(typeName);
         if (it != creators_.end() && it->second.fromInitStruct)
         {
+            const Atom type = it->first;
+
             // If name already exists, return an alias (no re-init)
             if (!init.name.empty())
             {
                 auto existing = displayObjects_.find(init.name);
                 if (existing != displayObjects_.end())
                 {
-                    return DisplayHandle(init.name, typeName);
+                    return DisplayHandle(init.name, type);
                 }
             }
 
@@ -642,22 +749,26 @@ namespace SDOM
             {
                 std::string name = init.name;
 
-                displayObject->setType(typeName);
+                displayObject->setType(type);
                 // Wrap and insert
-                displayObjects_[name] = std::make_unique<DisplayRecord>(std::move(displayObject), typeName, 0);
+                displayObjects_[name] = std::make_unique<DisplayRecord>(std::move(displayObject), type, 0);
                 auto& entry = displayObjects_[name];
                 // Run initialization callback now that registry entry exists
                 if (entry->obj) entry->obj->startup();
 
                 // Issue a stable id for this object before dispatching events so handles carry ids.
-                DisplayHandle handle(name, typeName);
+                DisplayHandle handle(name, entry->type);
                 try {
                     uint64_t id = registerDisplayObject(name, handle);
                     handle.setId(id);
                 } catch(...) {}
 
+                // New objects start parentless; adding them anywhere adopts them
+                if (entry->obj && !entry->obj->getParent()) noteOrphaned_(entry->obj.get());
+
                 // Dispatch OnInit event
                 auto& eventManager = getCore().getEventManager();
+                eventManager.trackDisplayObject(entry->obj.get());
                 std::unique_ptr<Event> initEvent =
                     std::make_unique<Event>(EventType::OnInit, handle);
 
@@ -678,7 +789,7 @@ namespace SDOM
         const std::string& typeName,
         const nlohmann::json& j)
     {
-        auto it = creators_.find(typeName);
+        auto it = findCreators_(typeName);
         if (it == creators_.end())
             return DisplayHandle{};
 
@@ -699,6 +810,390 @@ namespace SDOM
     }
 
 
+    std::vector<DisplayHandle> Factory::createDisplayObjects(
+        std::span<const IDisplayObject::InitStruct* const> inits)
+    {
+        std::vector<DisplayHandle> out(inits.size());
+        std::vector<std::unique_ptr<IDisplayObject>> built(inits.size());
+
+        // Stage 1: construct. Bulk loads are usually long runs of one type.
+        const std::string* lastType = nullptr;
+        const TypeCreators* creators = nullptr;
+        Atom type;
+        for (std::size_t i = 0; i < inits.size(); ++i)
+        {
+            const IDisplayObject::InitStruct* init = inits[i];
+            if (!init) continue;
+            if (!lastType || *lastType != init->type)
+            {
+                auto it = findCreators_(init->type);
+                creators = (it != creators_.end() && it->second.fromInitStruct) ? &it->second : nullptr;
+                type = creators ? it->first : Atom();
+                lastType = &init->type;
+            }
+            if (!creators) continue;
+
+            // If name already exists, return an alias (no re-init)
+            if (!init->name.empty() && displayObjects_.find(init->name) != displayObjects_.end())
+            {
+                out[i] = DisplayHandle(init->name, type);
+                continue;
+            }
+            built[i] = creators->fromInitStruct(*init);
+            if (built[i]) built[i]->setType(type);
+        }
+
+        // Stage 2: register
+        commitDisplayObjects_(built, out, /*aliasDuplicates*/true);
+        return out;
+    } // END: Factory::createDisplayObjects()
+
+    std::vector<DisplayHandle> Factory::createDisplayObjectsFromJson(
+        std::span<const nlohmann::json* const> nodes, std::span<const int> parents)
+    {
+        std::vector<DisplayHandle> out(nodes.size());
+        std::vector<std::unique_ptr<IDisplayObject>> built(nodes.size());
+
+        std::string lastType;
+        const TypeCreators* creators = nullptr;
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+        {
+            const nlohmann::json* node = nodes[i];
+            if (!node || !node->is_object()) continue;
+            // Skip the subtree of a node that was not built
+            if (i < parents.size() && parents[i] >= 0 &&
+                static_cast<std::size_t>(parents[i]) < i && !built[parents[i]])
+                continue;
+            const auto typeIt = node->find("type");
+            if (typeIt == node->end() || !typeIt->is_string()) continue;
+            const std::string& type = typeIt->get_ref<const std::string&>();
+            if (!creators || lastType != type)
+            {
+                auto it = findCreators_(type);
+                creators = (it != creators_.end() && it->second.fromJson) ? &it->second : nullptr;
+                lastType = type;
+            }
+            if (!creators) continue;
+            built[i] = creators->fromJson(*node);
+        }
+
+        commitDisplayObjects_(built, out, /*aliasDuplicates*/false);
+        return out;
+    } // END: Factory::createDisplayObjectsFromJson()
+
+    void Factory::reserveRegistry(std::size_t count)
+    {
+        displayObjects_.reserve(displayObjects_.size() + count);
+        orphans_.reserve(orphans_.size() + count);
+        orphanQueue_.reserve(orphanQueue_.size() + count);
+
+        std::lock_guard<std::mutex> lock(displaySlotMutex_);
+        const std::size_t reused = std::min(count, freeDisplaySlots_.size());
+        const std::size_t wanted = std::size_t(displaySlotCount_) + (count - reused);
+        const std::size_t lastPage = std::min<std::size_t>(
+            (wanted + DISPLAY_SLOT_PAGE_SIZE - 1) / DISPLAY_SLOT_PAGE_SIZE, DISPLAY_SLOT_MAX_PAGES);
+        for (std::size_t page = 0; page < lastPage; ++page)
+        {
+            if (!displaySlotPages_[page].load(std::memory_order_relaxed))
+                addDisplaySlotPage_(static_cast<uint32_t>(page));
+        }
+    } // END: Factory::reserveRegistry()
+
+    void Factory::commitDisplayObjects_(std::vector<std::unique_ptr<IDisplayObject>>& built,
+                                        std::vector<DisplayHandle>& out, bool aliasDuplicates)
+    {
+        std::size_t count = 0;
+        for (const auto& obj : built) if (obj) ++count;
+        if (count == 0) return;
+        reserveRegistry(count);
+
+        // Validate every name before touching the registry, so a bad batch
+        // throws with nothing inserted
+        std::vector<std::string> names(built.size());
+        std::unordered_map<std::string_view, std::size_t> firstInBatch;
+        firstInBatch.reserve(count);
+        for (std::size_t i = 0; i < built.size(); ++i)
+        {
+            if (!built[i]) continue;
+            names[i] = built[i]->getName();
+            if (names[i].empty())
+                ERROR("Factory::addDisplayObject: cannot add object with empty name");
+            auto existing = displayObjects_.find(names[i]);
+            auto [first, unique] = firstInBatch.try_emplace(names[i], i);
+            if (existing == displayObjects_.end() && unique) continue;
+            if (!aliasDuplicates)
+                ERROR(std::string("Factory::addDisplayObject: Display object with name '") + names[i] + "' already exists (add aborted)");
+        }
+
+        // Aliases resolve to the registered object, or to the first of the batch
+        if (aliasDuplicates)
+        {
+            for (std::size_t i = 0; i < built.size(); ++i)
+            {
+                if (!built[i]) continue;
+                auto existing = displayObjects_.find(names[i]);
+                const std::size_t first = firstInBatch.at(names[i]);
+                if (existing == displayObjects_.end() && first == i) continue;
+                const Atom type = (existing != displayObjects_.end() && existing->second)
+                    ? existing->second->type : built[first]->getTypeAtom();
+                out[i] = DisplayHandle(names[i], type);
+                built[i].reset();
+                --count;
+            }
+        }
+
+        // Insert and start up in input order, as the single-object path does
+        std::vector<std::size_t> fresh;
+        fresh.reserve(count);
+        for (std::size_t i = 0; i < built.size(); ++i)
+        {
+            if (!built[i]) continue;
+            const Atom type = built[i]->getTypeAtom();
+            auto [it, inserted] = displayObjects_.try_emplace(names[i]);
+            if (!inserted)
+            {
+                // An earlier startup() registered this name in the meantime
+                WARNING(std::string("Factory::addDisplayObject: Display object with name '") + names[i] + "' already exists (add skipped)");
+                built[i].reset();
+                continue;
+            }
+            it->second = std::make_unique<DisplayRecord>(std::move(built[i]), type, 0);
+            if (it->second->obj) it->second->obj->startup();
+            out[i] = DisplayHandle(names[i], type);
+            fresh.push_back(i);
+        }
+
+        // Issue every id under one lock
+        {
+            std::lock_guard<std::mutex> lock(displaySlotMutex_);
+            for (std::size_t i : fresh)
+            {
+                // Looked up again: a startup() above may have destroyed an earlier entry
+                auto it = displayObjects_.find(out[i].getName());
+                if (it == displayObjects_.end() || !it->second || !it->second->obj) continue;
+                try {
+                    it->second->id = acquireDisplaySlot_(it->second->obj.get());
+                    out[i].setId(it->second->id);
+                } catch(...) {}
+            }
+        }
+
+        // Track and announce, skipping anything an earlier startup() or OnInit destroyed
+        auto& eventManager = getCore().getEventManager();
+        DisplayHandle stageHandle = getCore().getRootNode();
+        for (std::size_t i : fresh)
+        {
+            DisplayHandle& handle = out[i];
+            IDisplayObject* obj = resolveDisplayObjectPtr(handle.getId());
+            if (!obj)
+            {
+                handle = DisplayHandle();
+                continue;
+            }
+            // New objects start parentless; adding them anywhere adopts them
+            if (!obj->getParent()) noteOrphaned_(obj);
+
+            eventManager.trackDisplayObject(obj);
+            std::unique_ptr<Event> initEvent = std::make_unique<Event>(EventType::OnInit, handle);
+            if (stageHandle)
+                initEvent->setRelatedTarget(stageHandle);
+            eventManager.dispatchEvent(std::move(initEvent), handle);
+        }
+    } // END: Factory::commitDisplayObjects_()
+
+
+    // --- Display Templates --- //
+
+    bool Factory::registerDisplayTemplate(const std::string& name, const nlohmann::json& subtree)
+    {
+        if (name.empty())
+        {
+            WARNING("Factory::registerDisplayTemplate: template name is empty");
+            return false;
+        }
+        DisplayTemplate tpl;
+        if (!compileTemplateNode_(subtree, -1, tpl))
+        {
+            WARNING("Factory::registerDisplayTemplate: template '" + name + "' was not registered");
+            return false;
+        }
+        displayTemplates_[name] = std::move(tpl);
+        return true;
+    } // END: Factory::registerDisplayTemplate()
+
+    void Factory::unregisterDisplayTemplate(const std::string& name)
+    {
+        displayTemplates_.erase(name);
+    } // END: Factory::unregisterDisplayTemplate()
+
+    bool Factory::hasDisplayTemplate(const std::string& name) const
+    {
+        return displayTemplates_.find(name) != displayTemplates_.end();
+    } // END: Factory::hasDisplayTemplate()
+
+    std::size_t Factory::getDisplayTemplateSize(const std::string& name) const
+    {
+        auto it = displayTemplates_.find(name);
+        return it != displayTemplates_.end() ? it->second.nodes.size() : 0;
+    } // END: Factory::getDisplayTemplateSize()
+
+    DisplayHandle Factory::instantiateDisplayTemplate(const std::string& name, const std::string& instanceName)
+    {
+        auto it = displayTemplates_.find(name);
+        if (it == displayTemplates_.end())
+        {
+            WARNING("Factory::instantiateDisplayTemplate: no template named '" + name + "'");
+            return DisplayHandle();
+        }
+        if (instanceName.empty())
+        {
+            std::vector<DisplayHandle> roots = instantiateDisplayTemplates(name, 1);
+            return roots.empty() ? DisplayHandle() : roots.front();
+        }
+        if (!templateNamesFree_(it->second, instanceName))
+        {
+            WARNING("Factory::instantiateDisplayTemplate: names for instance '" + instanceName + "' are already in use");
+            return DisplayHandle();
+        }
+        return instantiate_(it->second, { instanceName }).front();
+    } // END: Factory::instantiateDisplayTemplate()
+
+    std::vector<DisplayHandle> Factory::instantiateDisplayTemplates(const std::string& name, std::size_t count)
+    {
+        auto it = displayTemplates_.find(name);
+        if (it == displayTemplates_.end())
+        {
+            WARNING("Factory::instantiateDisplayTemplates: no template named '" + name + "'");
+            return {};
+        }
+        std::vector<std::string> roots;
+        roots.reserve(count);
+        while (roots.size() < count)
+        {
+            std::string root = name + "_" + std::to_string(nextTemplateInstance_++);
+            if (templateNamesFree_(it->second, root))
+                roots.push_back(std::move(root));
+        }
+        return instantiate_(it->second, roots);
+    } // END: Factory::instantiateDisplayTemplates()
+
+    bool Factory::compileTemplateNode_(const nlohmann::json& node, int parent, DisplayTemplate& tpl)
+    {
+        if (!node.is_object())
+        {
+            WARNING("Factory::registerDisplayTemplate: template node is not an object");
+            return false;
+        }
+        const std::string type = node.value("type", "");
+        auto it = findCreators_(type);
+        if (it == creators_.end() || !it->second.parseJson || !it->second.fromInitStruct)
+        {
+            WARNING("Factory::registerDisplayTemplate: type '" + type + "' has no parseJson creator");
+            return false;
+        }
+
+        DisplayTemplate::Node compiled;
+        compiled.type = it->first;
+        compiled.init = it->second.parseJson(node);
+        compiled.create = it->second.fromInitStruct;
+        compiled.parent = parent;
+        if (!compiled.init) return false;
+        compiled.init->type = type;
+
+        // Unnamed nodes default to their type name; keep local names unique
+        const int index = static_cast<int>(tpl.nodes.size());
+        auto taken = [&tpl](const std::string& local) {
+            if (local.empty()) return true;
+            for (const auto& other : tpl.nodes)
+                if (other.localName == local) return true;
+            return false;
+        };
+        compiled.localName = compiled.init->name;
+        for (int n = index; taken(compiled.localName); ++n)
+            compiled.localName = type + "_" + std::to_string(n);
+        tpl.nodes.push_back(std::move(compiled));
+        if (parent >= 0) tpl.nodes[parent].children.push_back(index);
+
+        if (auto childIt = node.find("children"); childIt != node.end() && childIt->is_array())
+        {
+            for (const auto& child : *childIt)
+            {
+                if (!compileTemplateNode_(child, index, tpl))
+                    return false;
+            }
+        }
+        return true;
+    } // END: Factory::compileTemplateNode_()
+
+    bool Factory::templateNamesFree_(const DisplayTemplate& tpl, const std::string& root) const
+    {
+        if (displayObjects_.find(root) != displayObjects_.end()) return false;
+        for (std::size_t n = 1; n < tpl.nodes.size(); ++n)
+        {
+            if (displayObjects_.find(root + "." + tpl.nodes[n].localName) != displayObjects_.end())
+                return false;
+        }
+        return true;
+    } // END: Factory::templateNamesFree_()
+
+    std::vector<DisplayHandle> Factory::instantiate_(DisplayTemplate& tpl, const std::vector<std::string>& roots)
+    {
+        const std::size_t perInstance = tpl.nodes.size();
+        std::vector<std::unique_ptr<IDisplayObject>> built(roots.size() * perInstance);
+        std::vector<DisplayHandle> handles(built.size());
+
+        // Construct from the compiled structs; only the name differs per copy
+        {
+            // The structs belong to the template: put the local names back
+            // even if a constructor throws partway through
+            struct NameRestore
+            {
+                DisplayTemplate& tpl;
+                ~NameRestore()
+                {
+                    for (auto& node : tpl.nodes)
+                        node.init->name = node.localName;
+                }
+            } restore{ tpl };
+
+            for (std::size_t r = 0; r < roots.size(); ++r)
+            {
+                for (std::size_t n = 0; n < perInstance; ++n)
+                {
+                    DisplayTemplate::Node& node = tpl.nodes[n];
+                    node.init->name = (n == 0) ? roots[r] : roots[r] + "." + node.localName;
+                    auto& obj = built[r * perInstance + n];
+                    obj = node.create(*node.init);
+                    if (obj) obj->setType(node.type);
+                }
+            }
+        }
+
+        commitDisplayObjects_(built, handles, /*aliasDuplicates*/false);
+
+        std::vector<DisplayHandle> out;
+        out.reserve(roots.size());
+        for (std::size_t r = 0; r < roots.size(); ++r)
+        {
+            DisplayHandle* instance = handles.data() + r * perInstance;
+            attachTemplateNode_(tpl, instance, 0);
+            out.push_back(instance[0]);
+        }
+        return out;
+    } // END: Factory::instantiate_()
+
+    void Factory::attachTemplateNode_(const DisplayTemplate& tpl, DisplayHandle* handles, int index)
+    {
+        // Bottom-up, so each subtree is whole before it joins its parent
+        for (int child : tpl.nodes[index].children)
+        {
+            attachTemplateNode_(tpl, handles, child);
+            if (handles[index].isValid() && handles[child].isValid())
+                handles[index]->addChild(handles[child]);
+        }
+    } // END: Factory::attachTemplateNode_()
+
+
 
     AssetHandle Factory::createAssetObject(const std::string& typeName, const IAssetObject::InitStruct& init)
     {
@@ -871,8 +1366,8 @@ namespace SDOM
         {
             if (entry->type.empty())
             {
-                entry->type = entry->obj->getType();
-                type = entry->type;
+                entry->type = entry->obj->getTypeAtom();
+                type = entry->type.str();
             }
 
             entry->obj->startup();
@@ -883,7 +1378,10 @@ namespace SDOM
                 handle.setId(id);
             } catch(...) {}
 
+            if (!entry->obj->getParent()) noteOrphaned_(entry->obj.get());
+
             auto& eventManager = getCore().getEventManager();
+            eventManager.trackDisplayObject(entry->obj.get());
             std::unique_ptr<Event> initEvent =
                 std::make_unique<Event>(EventType::OnInit, handle);
 
@@ -899,10 +1397,28 @@ namespace SDOM
     {
         auto it = displayObjects_.find(name);
         if (it != displayObjects_.end()) {
+            // Children still pointing at this object are orphaned by its removal
+            if (it->second && it->second->obj) {
+                IDisplayObject* obj = it->second->obj.get();
+                orphans_.erase(obj);
+                for (const auto& childHandle : obj->getChildren()) {
+                    IDisplayObject* child = childHandle.get();
+                    if (child && child != obj && child->getParent().get() == obj) {
+                        child->orphanedAt_ = std::chrono::steady_clock::now();
+                        noteOrphaned_(child);
+                    }
+                }
+            }
             uint64_t id = it->second ? it->second->id : 0;
             if (id != 0) {
                 try { unregisterDisplayObject(id); } catch(...) {}
             }
+            // Any surviving children cached world edges relative to this object.
+            if (it->second && it->second->obj) {
+                it->second->obj->invalidateWorldBounds();
+            }
+            // The render list holds raw pointers; force a rebuild before reuse.
+            Core::getInstance().invalidateRenderList(/*objectsDestroyed*/true);
         }
         displayObjects_.erase(name);
     }
@@ -937,34 +1453,28 @@ namespace SDOM
  
 
     int Factory::countOrphanedDisplayObjects() const {
-        int count = 0;
-        for (const auto& [name, objPtr] : displayObjects_) {
-            auto obj = dynamic_cast<IDisplayObject*>(objPtr->obj.get());
-            if (obj && !obj->getParent() && obj->getType() != "Stage") {
-                ++count;
-            }
-        }
-        return count;
+        return static_cast<int>(orphans_.size());
     }
 
     std::vector<DisplayHandle> Factory::getOrphanedDisplayObjects() {
         std::vector<DisplayHandle> orphans;
-        for (const auto& [name, objPtr] : displayObjects_) {
-            auto obj = dynamic_cast<IDisplayObject*>(objPtr->obj.get());
-            if (obj && !obj->getParent() && obj->getType() != "Stage") {
-                orphans.push_back(getDisplayObject(name));
-            }
+        orphans.reserve(orphans_.size());
+        for (const auto& [obj, ticket] : orphans_) {
+            orphans.push_back(getDisplayObject(obj->getName()));
         }
         return orphans;
     }
 
     void Factory::destroyOrphanedDisplayObjects() 
     {
-        while (countOrphanedDisplayObjects())
+        // Destroying an orphan orphans its children, so repeat until none remain
+        while (!orphans_.empty())
         {
-            auto orphans = getOrphanedDisplayObjects();
-            for (const auto& orphan : orphans) {
-                destroyDisplayObject(orphan->getName());
+            std::vector<std::string> names;
+            names.reserve(orphans_.size());
+            for (const auto& [obj, ticket] : orphans_) names.push_back(obj->getName());
+            for (const auto& name : names) {
+                destroyDisplayObject(name);
             }
         }
     }    
@@ -1053,6 +1563,9 @@ namespace SDOM
 
         // Clear auxiliary registries/lists
         orphanList_.clear();
+        orphans_.clear();
+        orphanQueue_.clear();
+        SlabPool::displayObjects().trim();  // return slabs of emptied types to the heap
         futureChildrenList_.clear();
         creators_.clear();
         assetCreators_.clear();
@@ -1306,6 +1819,53 @@ namespace SDOM
         futureChildrenList_.clear();
     }
 
+    void Factory::noteOrphaned_(IDisplayObject* obj)
+    {
+        static const Atom stageType("Stage");
+        if (!obj || obj->getTypeAtom() == stageType) return;
+        // Only registry-owned objects are collected; anything else is not ours to destroy
+        auto it = displayObjects_.find(obj->getName());
+        if (it == displayObjects_.end() || !it->second || it->second->obj.get() != obj) return;
+
+        const uint64_t ticket = nextOrphanTicket_++;
+        orphans_[obj] = ticket;
+        pushOrphan_(obj, ticket);
+    } // END: Factory::noteOrphaned_()
+
+    void Factory::noteAdopted_(IDisplayObject* obj)
+    {
+        // Its queue entry goes stale and is dropped when it reaches the top
+        orphans_.erase(obj);
+    } // END: Factory::noteAdopted_()
+
+    void Factory::requeueOrphan_(IDisplayObject* obj)
+    {
+        auto it = orphans_.find(obj);
+        if (it != orphans_.end())
+            pushOrphan_(obj, it->second);
+    } // END: Factory::requeueOrphan_()
+
+    void Factory::pushOrphan_(IDisplayObject* obj, uint64_t ticket)
+    {
+        OrphanEntry entry;
+        entry.obj = obj;
+        entry.ticket = ticket;
+        switch (obj->getOrphanRetentionPolicy())
+        {
+            case IDisplayObject::OrphanRetentionPolicy::AutoDestroy:
+                entry.due = obj->orphanedAt_;
+                break;
+            case IDisplayObject::OrphanRetentionPolicy::GracePeriod:
+                entry.due = obj->orphanedAt_ + obj->getOrphanGrace();
+                break;
+            case IDisplayObject::OrphanRetentionPolicy::RetainUntilManual:
+            default:
+                return;     // listed as an orphan, never collected
+        }
+        orphanQueue_.push_back(entry);
+        std::push_heap(orphanQueue_.begin(), orphanQueue_.end(), std::greater<OrphanEntry>());
+    } // END: Factory::pushOrphan_()
+
     void Factory::addToOrphanList(const DisplayHandle orphan) 
     {
         if (orphan) 
@@ -0,0 +1,175 @@
+// SDOM_GlyphAtlas.cpp
+
+#include <SDOM/SDOM.hpp>
+#include <SDOM/SDOM_Core.hpp>
+#include <SDOM/SDOM_GlyphAtlas.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace SDOM
+{
+    GlyphAtlas::~GlyphAtlas()
+    {
+        clear();
+    } // END: GlyphAtlas::~GlyphAtlas()
+
+    const GlyphAtlas::Glyph* GlyphAtlas::getGlyph(SDL_Renderer* renderer, TTF_Font* font, Uint32 ch, const Variant& variant)
+    {
+        if (!renderer || !font) return nullptr;
+
+        // Pages belong to a single renderer; start over if it changed
+        if (renderer != renderer_)
+        {
+            clear();
+            renderer_ = renderer;
+        }
+
+        Key key;
+        key.ch = ch;
+        key.sizeQ = static_cast<int>(std::lround(variant.ptSize * 64.0f));
+        key.styleMask = variant.styleMask;
+        key.outline = variant.outline;
+
+        auto it = glyphs_.find(key);
+        if (it != glyphs_.end())
+        {
+            ++hits_;
+            return &it->second;
+        }
+
+        if (!TTF_FontHasGlyph(font, ch)) return nullptr;
+
+        // The font is shared with its owner's direct rendering; put back the
+        // style and outline it had once this glyph is rasterized
+        const TTF_FontStyleFlags prevStyle = TTF_GetFontStyle(font);
+        const int prevOutline = TTF_GetFontOutline(font);
+
+        // Advance is measured without the outline so every pass shares one pen
+        TTF_SetFontStyle(font, variant.styleMask);
+        TTF_SetFontOutline(font, 0);
+        int minx = 0, maxx = 0, miny = 0, maxy = 0, advance = 0;
+        TTF_GetGlyphMetrics(font, ch, &minx, &maxx, &miny, &maxy, &advance);
+        TTF_SetFontOutline(font, variant.outline);
+
+        Glyph glyph;
+        glyph.advance = advance;
+
+        SDL_Surface* surface = TTF_RenderGlyph_Blended(font, ch, SDL_Color{ 255, 255, 255, 255 });
+        TTF_SetFontStyle(font, prevStyle);
+        TTF_SetFontOutline(font, prevOutline);
+        if (surface && surface->w > 0 && surface->h > 0)
+        {
+            SDL_Surface* converted = (surface->format == SDL_PIXELFORMAT_ARGB8888)
+                ? surface : SDL_ConvertSurface(surface, SDL_PIXELFORMAT_ARGB8888);
+            int page = -1, px = 0, py = 0;
+            if (converted && allocate_(renderer, converted->w, converted->h, page, px, py))
+            {
+                SDL_Rect dst = { px, py, converted->w, converted->h };
+                if (SDL_UpdateTexture(pages_[page].texture, &dst, converted->pixels, converted->pitch))
+                {
+                    glyph.page = page;
+                    glyph.src = { static_cast<float>(px), static_cast<float>(py),
+                                  static_cast<float>(converted->w), static_cast<float>(converted->h) };
+                }
+                else
+                {
+                    DEBUG_LOG(std::string("GlyphAtlas::getGlyph - SDL_UpdateTexture failed: ") + SDL_GetError());
+                }
+            }
+            if (converted && converted != surface) SDL_DestroySurface(converted);
+        }
+        if (surface) SDL_DestroySurface(surface);
+
+        ++rasterized_;
+        auto [ins, ok] = glyphs_.emplace(key, glyph);
+        (void)ok;
+        return &ins->second;
+    } // END: GlyphAtlas::getGlyph()
+
+    void GlyphAtlas::drawGlyph(SDL_Renderer* renderer, const Glyph& glyph, float x, float y, SDL_Color color) const
+    {
+        SDL_Texture* texture = getPageTexture(glyph.page);
+        if (!renderer || !texture) return;
+        SDL_FRect dst = { x, y, glyph.src.w, glyph.src.h };
+        getCore().getSpriteBatch().addQuad(renderer, texture, glyph.src, dst, color, SDL_SCALEMODE_LINEAR);
+    } // END: GlyphAtlas::drawGlyph()
+
+    SDL_Texture* GlyphAtlas::getPageTexture(int page) const
+    {
+        if (page < 0 || page >= static_cast<int>(pages_.size())) return nullptr;
+        return pages_[page].texture;
+    } // END: GlyphAtlas::getPageTexture()
+
+    void GlyphAtlas::clear()
+    {
+        for (auto& page : pages_)
+        {
+            if (page.texture) SDL_DestroyTexture(page.texture);
+        }
+        pages_.clear();
+        glyphs_.clear();
+        renderer_ = nullptr;
+    } // END: GlyphAtlas::clear()
+
+    GlyphAtlas::Stats GlyphAtlas::getStats() const
+    {
+        Stats s;
+        s.pages = pages_.size();
+        s.glyphs = glyphs_.size();
+        s.hits = hits_;
+        s.rasterized = rasterized_;
+        return s;
+    } // END: GlyphAtlas::getStats()
+
+    bool GlyphAtlas::allocate_(SDL_Renderer* renderer, int w, int h, int& outPage, int& outX, int& outY)
+    {
+        const int pw = w + PADDING * 2;
+        const int ph = h + PADDING * 2;
+
+        if (pages_.empty() && !addPage_(renderer, pw, ph)) return false;
+
+        Page* page = &pages_.back();
+        if (page->shelfX + pw > page->width)
+        {
+            // Close the current shelf and open a new one below it
+            page->shelfY += page->shelfH;
+            page->shelfX = 0;
+            page->shelfH = 0;
+        }
+        if (page->shelfX + pw > page->width || page->shelfY + ph > page->height)
+        {
+            if (!addPage_(renderer, pw, ph)) return false;
+            page = &pages_.back();
+        }
+
+        outPage = static_cast<int>(pages_.size()) - 1;
+        outX = page->shelfX + PADDING;
+        outY = page->shelfY + PADDING;
+        page->shelfX += pw;
+        page->shelfH = std::max(page->shelfH, ph);
+        return true;
+    } // END: GlyphAtlas::allocate_()
+
+    bool GlyphAtlas::addPage_(SDL_Renderer* renderer, int minW, int minH)
+    {
+        Page page;
+        page.width = std::max(PAGE_SIZE, minW);
+        page.height = std::max(PAGE_SIZE, minH);
+        page.texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, page.width, page.height);
+        if (!page.texture)
+        {
+            DEBUG_LOG(std::string("GlyphAtlas::addPage_ - SDL_CreateTexture failed: ") + SDL_GetError());
+            return false;
+        }
+        SDL_SetTextureBlendMode(page.texture, SDL_BLENDMODE_BLEND);
+
+        // Clear the page so padding never samples uninitialized texels
+        std::vector<Uint32> blank(static_cast<std::size_t>(page.width) * page.height, 0u);
+        SDL_UpdateTexture(page.texture, nullptr, blank.data(), page.width * static_cast<int>(sizeof(Uint32)));
+
+        pages_.push_back(page);
+        return true;
+    } // END: GlyphAtlas::addPage_()
+
+} // END: namespace SDOM
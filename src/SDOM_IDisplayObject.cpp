@@ -42,6 +42,7 @@
 #include <SDOM/SDOM_DisplayHandle.hpp>
 #include <SDOM/SDOM_EventManager.hpp>
 #include <SDOM/SDOM_Factory.hpp>
+#include <SDOM/SDOM_SlabPool.hpp>
 #include <SDOM/SDOM_Utils.hpp>
 #include <SDOM/SDOM_DisplayHandle.hpp>
 
@@ -108,7 +109,7 @@ namespace SDOM
          : IDataObject()
     {
         name_ = init.name;
-        type_ = init.type.empty() ? TypeName : init.type;
+        type_ = Atom(init.type.empty() ? TypeName : init.type);
         color_ = init.color;
 
         foregroundColor_ = init.foregroundColor;
@@ -122,6 +123,8 @@ namespace SDOM
         isClickable_ = init.isClickable;
         isEnabled_ = init.isEnabled;
         isHidden_ = init.isHidden;
+        cacheAsBitmap_ = init.cacheAsBitmap;
+        clipChildren_ = init.clipChildren;
         background_ = init.hasBackground;
         border_ = init.hasBorder;
         tabPriority_ = init.tabPriority;
@@ -202,7 +205,7 @@ namespace SDOM
 
         // --- Required Properties --- //
         name_ = config["name"].get_or(std::string(TypeName));
-        type_ = config["type"].get_or(std::string(TypeName));
+        type_ = Atom(config["type"].get_or(std::string(TypeName)));
 
         // fetch coordinates:
         float x = get_float("x",     init_default.x);
@@ -250,6 +253,8 @@ namespace SDOM
         setTabEnabled(  get_bool("tab_enabled", init_default.tabEnabled  ));
         setBackground(  get_bool("background", init_default.hasBackground) );
         setBorder(      get_bool("border",     init_default.hasBorder) );
+        setCacheAsBitmap(get_bool("cache_as_bitmap", init_default.cacheAsBitmap));
+        setClipChildren(get_bool("clip_children", init_default.clipChildren));
 
     } // END IDisplayObject::IDisplayObject(const sol::table& config)
 
@@ -311,7 +316,7 @@ namespace SDOM
 
         // --- Required Properties --- //
         name_ = config["name"].get_or(std::string(TypeName));
-        type_ = config["type"].get_or(std::string(TypeName));
+        type_ = Atom(config["type"].get_or(std::string(TypeName)));
 
         // fetch coordinates:
         float x = get_float("x",     init_default.x);
@@ -358,9 +363,21 @@ namespace SDOM
         setTabEnabled(  get_bool("tab_enabled", init_default.tabEnabled  ));
         setBackground(  get_bool("background", init_default.hasBackground) );
         setBorder(      get_bool("border",     init_default.hasBorder) );
+        setCacheAsBitmap(get_bool("cache_as_bitmap", init_default.cacheAsBitmap));
+        setClipChildren(get_bool("clip_children", init_default.clipChildren));
 
     } // END IDisplayObject::IDisplayObject(const sol::table& config, const InitStruct& defaults)
 
+    void* IDisplayObject::operator new(std::size_t size)
+    {
+        return SlabPool::displayObjects().allocate(size);
+    }
+
+    void IDisplayObject::operator delete(void* ptr, std::size_t size) noexcept
+    {
+        SlabPool::displayObjects().deallocate(ptr, size);
+    }
+
     IDisplayObject::~IDisplayObject()
     {
         // nameRegistry_.erase(getName());
@@ -369,6 +386,24 @@ namespace SDOM
         // so that derived virtual onQuit() implementations run while the object
         // is still fully-formed. Previously this destructor invoked onQuit()
         // which triggered analyzer noise and can be unsafe in derived types.
+
+        // Drop any listener subscriptions/hover tracking held for this object.
+        if (Core::eventManager_)
+            Core::eventManager_->forgetDisplayObject(this);
+    }
+
+    IDisplayObject& IDisplayObject::setType(const std::string& newType)
+    {
+        return setType(Atom(newType));
+    }
+
+    IDisplayObject& IDisplayObject::setType(Atom newType)
+    {
+        type_ = newType;
+        // Hover tracking is keyed on type
+        if (Core::eventManager_)
+            Core::eventManager_->trackDisplayObject(this);
+        return *this;
     }
 
     bool IDisplayObject::onInit()
@@ -574,11 +609,11 @@ namespace SDOM
         Factory* factory = &core->getFactory();
         if (core->getIsTraversing())
         {
-            factory->addToFutureChildrenList(child, DisplayHandle(getName(), child->getType()), useWorld, worldX, worldY);
+            factory->addToFutureChildrenList(child, DisplayHandle(getName(), child->getTypeAtom()), useWorld, worldX, worldY);
         }
         else
         {
-            attachChild_(child, DisplayHandle(getName(), getType()), useWorld, worldX, worldY);
+            attachChild_(child, DisplayHandle(getName(), getTypeAtom()), useWorld, worldX, worldY);
         }
     }
 
@@ -625,18 +660,9 @@ namespace SDOM
             return true;
         }
 
-        // Detach and dispatch lifecycle events now (safe when not traversing)
+        // Detach and dispatch lifecycle events now (safe when not traversing).
+        // setParent() stamps orphanedAt_ and queues the child for collection.
         removeOrphan_(child);
-
-        // For policies that defer destruction (e.g., GracePeriod), track orphans
-        // for later garbage collection. AutoDestroy and RetainUntilManual skip scheduling.
-        auto policy = child->getOrphanRetentionPolicy();
-        if (policy != OrphanRetentionPolicy::AutoDestroy &&
-            policy != OrphanRetentionPolicy::RetainUntilManual)
-        {
-            child->orphanedAt_ = std::chrono::steady_clock::now();
-            factory->addToOrphanList(child);
-        }
         return true;
     }    
 
@@ -655,7 +681,7 @@ namespace SDOM
             // Schedule via Factory so it applies after traversal
             int worldX = static_cast<int>(getX());
             int worldY = static_cast<int>(getY());
-            DisplayHandle me(getName(), getType());
+            DisplayHandle me(getName(), getTypeAtom());
             Core::getInstance().addToFutureChildrenList(me, parent, /*useWorld*/true, worldX, worldY);
             return *this;
         }
@@ -666,7 +692,7 @@ namespace SDOM
             IDisplayObject* oldParentObj = dynamic_cast<IDisplayObject*>(parent_.get());
             if (oldParentObj) 
             {
-                DisplayHandle me(getName(), getType());
+                DisplayHandle me(getName(), getTypeAtom());
                 auto& vec = oldParentObj->children_;
                 vec.erase(std::remove_if(vec.begin(), vec.end(), [&](const DisplayHandle& d) { return d == me; }), vec.end());
             }
@@ -674,6 +700,19 @@ namespace SDOM
 
         // Assign new parent handle
         parent_ = parent;
+        invalidateWorldBounds();
+        getCore().invalidateRenderList();
+
+        // Keep the Factory's orphan set current so collection never scans the registry
+        if (parent_.isValid())
+        {
+            getFactory().noteAdopted_(this);
+        }
+        else
+        {
+            orphanedAt_ = std::chrono::steady_clock::now();
+            getFactory().noteOrphaned_(this);
+        }
 
         if (getName() == "blueishBox" || (parent_.isValid() && parent_.getName() == "redishBox")) {
             std::ostringstream oss; oss << "[DBG] setParent: child='" << getName() << "' newParent='" << (parent_.isValid() ? parent_.getName() : std::string("<null>")) << "' worldLeft=" << world.left << " worldTop=" << world.top << " worldRight=" << world.right << " worldBottom=" << world.bottom;
@@ -692,7 +731,7 @@ namespace SDOM
             IDisplayObject* newParentObj = dynamic_cast<IDisplayObject*>(parent_.get());
             if (newParentObj) 
             {
-                DisplayHandle me(getName(), getType());
+                DisplayHandle me(getName(), getTypeAtom());
                 auto& vec = newParentObj->children_;
                 // DEBUG_LOG("setParent newParent='" << newParentObj->getName() << "' children_count_before=" << vec.size());
                 auto it = std::find(vec.begin(), vec.end(), me);
@@ -767,13 +806,13 @@ namespace SDOM
         std::function<void(Event&)> listener,
         bool useCapture)
     {
-        auto& targetListeners = useCapture ? captureEventListeners : bubblingEventListeners;
-        auto it = targetListeners.find(type);
-        if (it == targetListeners.end()) return;
+        auto* found = findListeners_(useCapture ? captureEventListeners : bubblingEventListeners, type.getOrAssignId());
+        if (!found) return;
 
-        auto& listeners = it->second;
+        auto& listeners = *found;
         // If a null/empty function is provided, remove all listeners for this type
         if (!listener) {
+            getCore().getEventManager().removeListenerSubscription(type, this, static_cast<int>(listeners.size()));
             listeners.clear();
             return;
         }
@@ -804,6 +843,10 @@ namespace SDOM
             }
             if (allSameType) listeners.clear();
         }
+
+        const std::size_t removed = before - listeners.size();
+        if (removed > 0)
+            getCore().getEventManager().removeListenerSubscription(type, this, static_cast<int>(removed));
     }
 
 
@@ -813,25 +856,47 @@ namespace SDOM
         bool useCapture, 
         int priority)
     {
-        auto& targetListeners = useCapture ? captureEventListeners : bubblingEventListeners;
-        targetListeners[type].push_back({std::move(listener), priority, type});
+        auto& listeners = getOrCreateListeners_(useCapture ? captureEventListeners : bubblingEventListeners, type.getOrAssignId());
+        listeners.push_back({std::move(listener), priority, type});
+        getCore().getEventManager().addListenerSubscription(type, this);
 
         // Sort listeners by priority if the new listener has a non-zero priority
-        std::sort(targetListeners[type].begin(), targetListeners[type].end(),
+        std::sort(listeners.begin(), listeners.end(),
             [](const ListenerEntry& a, const ListenerEntry& b) {
                 return a.priority > b.priority; // Higher priority first
             });
     }
 
+    std::vector<IDisplayObject::ListenerEntry>* IDisplayObject::findListeners_(
+        const std::unique_ptr<ListenerTable>& table, EventType::IdType typeId)
+    {
+        if (!table || typeId == 0) return nullptr;
+        auto it = std::lower_bound(table->begin(), table->end(), typeId,
+            [](const ListenerBucket& bucket, EventType::IdType id) { return bucket.typeId < id; });
+        if (it == table->end() || it->typeId != typeId) return nullptr;
+        return &it->listeners;
+    }
 
-    void IDisplayObject::triggerEventListeners(Event& event, bool useCapture)
+    std::vector<IDisplayObject::ListenerEntry>& IDisplayObject::getOrCreateListeners_(
+        std::unique_ptr<ListenerTable>& table, EventType::IdType typeId)
     {
-        const auto& targetListeners = useCapture ? captureEventListeners : bubblingEventListeners;
+        if (!table) table = std::make_unique<ListenerTable>();
+        auto it = std::lower_bound(table->begin(), table->end(), typeId,
+            [](const ListenerBucket& bucket, EventType::IdType id) { return bucket.typeId < id; });
+        if (it == table->end() || it->typeId != typeId)
+            it = table->insert(it, ListenerBucket{ typeId, {} });
+        return it->listeners;
+    }
 
-        auto it = targetListeners.find(event.getType());
-        if (it != targetListeners.end()) 
+
+    void IDisplayObject::triggerEventListeners(Event& event, bool useCapture)
+    {
+        auto* listeners = findListeners_(useCapture ? captureEventListeners : bubblingEventListeners, event.getTypeId());
+        if (listeners) 
         {
-            for (const auto& entry : it->second) 
+            // Bucket vectors keep their storage when the table grows, so listeners
+            // registering other event types mid-dispatch do not invalidate this loop.
+            for (const auto& entry : *listeners) 
             {
                 entry.listener(event);
             }
@@ -840,26 +905,23 @@ namespace SDOM
 
     bool IDisplayObject::hasEventListener(const EventType& type, bool useCapture) const
     {
-        const auto& targetListeners = useCapture ? captureEventListeners : bubblingEventListeners;
-        auto it = targetListeners.find(type);
-        if (it == targetListeners.end()) return false;
-        return !it->second.empty();
+        auto* listeners = findListeners_(useCapture ? captureEventListeners : bubblingEventListeners, type.getId());
+        return listeners && !listeners->empty();
     }
 
 
     // --- Debug utilities: dump registered listeners to stdout -------------------- //
     namespace {
         static void print_listener_bucket(const char* bucketName,
-                                           const std::unordered_map<EventType,
-                                                                     std::vector<IDisplayObject::ListenerEntry>,
-                                                                     EventTypeHash>& bucket)
+                                           const std::unique_ptr<IDisplayObject::ListenerTable>& table)
         {
-            std::cout << bucketName << ": size=" << bucket.size() << std::endl;
-            for (const auto& kv : bucket)
+            std::cout << bucketName << ": size=" << (table ? table->size() : 0) << std::endl;
+            if (!table) return;
+            for (const auto& bucket : *table)
             {
-                const EventType& et = kv.first;
-                const auto& vec = kv.second;
-                std::cout << "  - [" << et.getName() << "] listeners=" << vec.size() << std::endl;
+                const EventType* et = EventType::fromId(bucket.typeId);
+                const auto& vec = bucket.listeners;
+                std::cout << "  - [" << (et ? et->getName() : std::to_string(bucket.typeId)) << "] listeners=" << vec.size() << std::endl;
                 for (std::size_t i = 0; i < vec.size(); ++i)
                 {
                     const auto& e = vec[i];
@@ -1003,6 +1065,7 @@ namespace SDOM
             }
         }
 
+        getCore().invalidateRenderList();
         return *this;
     } // IDisplayObject& IDisplayObject::sortChildrenByPriority()
 
@@ -1074,6 +1137,27 @@ namespace SDOM
     }
 
 
+    IDisplayObject& IDisplayObject::setZOrder(int z)
+    {
+        if (z_order_ != z)
+        {
+            z_order_ = z;
+            setParentZOrderDirty(true);
+        }
+        return *this;
+    } // END: IDisplayObject::setZOrder()
+
+    void IDisplayObject::setParentZOrderDirty(bool dirty_z)
+    {
+        if (parent_) {
+            parent_->zOrderDirty_ = dirty_z;
+            // The render list is flattened in sibling order; rebuild it this frame
+            if (dirty_z)
+                getCore().invalidateRenderList();
+        }
+    } // END: IDisplayObject::setParentZOrderDirty()
+
+
     IDisplayObject& IDisplayObject::bringToFront()
     {
         // If we have a parent, push this object above its siblings
@@ -1167,6 +1251,7 @@ namespace SDOM
             }
         }
 
+        getCore().invalidateRenderList();
         return *this;
     }
     
@@ -1236,6 +1321,20 @@ namespace SDOM
         return false;
     }
 
+    IDisplayObject& IDisplayObject::setOrphanRetentionPolicy(OrphanRetentionPolicy policy)
+    {
+        orphanPolicy_ = policy;
+        getFactory().requeueOrphan_(this);  // a pending orphan picks up the new deadline
+        return *this;
+    }
+
+    IDisplayObject& IDisplayObject::setOrphanGrace(std::chrono::milliseconds grace)
+    {
+        orphanGrace = grace;
+        getFactory().requeueOrphan_(this);
+        return *this;
+    }
+
     // Remove this object from its parent (convenience)
     bool IDisplayObject::removeFromParent()
     {
@@ -1244,7 +1343,7 @@ namespace SDOM
         IDisplayObject* parentObj = dynamic_cast<IDisplayObject*>(parentHandle.get());
         if (!parentObj) return false;
         // Attempt removal; parentObj->removeChild will perform checks and orphan handling
-        DisplayHandle me(getName(), getType());
+        DisplayHandle me(getName(), getTypeAtom());
         return parentObj->removeChild(me);
     }
 
@@ -1345,7 +1444,7 @@ namespace SDOM
 
     void IDisplayObject::setKeyboardFocus() 
     { 
-        Core::getInstance().setKeyboardFocusedObject(DisplayHandle(getName(), getType())); 
+        Core::getInstance().setKeyboardFocusedObject(DisplayHandle(getName(), getTypeAtom())); 
     }
     bool IDisplayObject::isKeyboardFocused() const
     {
@@ -1460,107 +1559,106 @@ namespace SDOM
 
     float IDisplayObject::getLeft() const
     {
-        auto* parent = dynamic_cast<IDisplayObject*>(parent_.get());
-        if (parent == this) 
-        {
-            ERROR("Cycle detected: node is its own parent!");
-        }
-        if (parent) 
-        {
-            switch (anchorLeft_) 
-            {
-                case AnchorPoint::TOP_LEFT:
-                case AnchorPoint::MIDDLE_LEFT:
-                case AnchorPoint::BOTTOM_LEFT:
-                    return parent->getLeft() + left_;
-                case AnchorPoint::TOP_CENTER:
-                case AnchorPoint::MIDDLE_CENTER:
-                case AnchorPoint::BOTTOM_CENTER:
-                    return parent->getLeft() + parent->getWidth() / 2 + left_;
-                case AnchorPoint::TOP_RIGHT:
-                case AnchorPoint::MIDDLE_RIGHT:
-                case AnchorPoint::BOTTOM_RIGHT:
-                    return parent->getLeft() + parent->getWidth() + left_;
-            }
-        }
-        return left_; // root node or no parent
+        if (worldBoundsDirty_) updateWorldBounds_();
+        return worldBounds_.left;
     }
 
-
     float IDisplayObject::getRight() const
     {
-        auto* parent = dynamic_cast<IDisplayObject*>(parent_.get());
-        if (parent == this) {
-            ERROR("Cycle detected: node is its own parent!");
-        }
-        if (parent) {
-            switch (anchorRight_) {
-                case AnchorPoint::TOP_LEFT:
-                case AnchorPoint::MIDDLE_LEFT:
-                case AnchorPoint::BOTTOM_LEFT:
-                    return parent->getLeft() + right_;
-                case AnchorPoint::TOP_CENTER:
-                case AnchorPoint::MIDDLE_CENTER:
-                case AnchorPoint::BOTTOM_CENTER:
-                    return parent->getLeft() + parent->getWidth() / 2 + right_;
-                case AnchorPoint::TOP_RIGHT:
-                case AnchorPoint::MIDDLE_RIGHT:
-                case AnchorPoint::BOTTOM_RIGHT:
-                    return parent->getLeft() + parent->getWidth() + right_;
-            }
-        }
-        return right_; // root node or no parent
+        if (worldBoundsDirty_) updateWorldBounds_();
+        return worldBounds_.right;
     }
 
     float IDisplayObject::getTop() const
     {
-        auto* parent = dynamic_cast<IDisplayObject*>(parent_.get());
-        if (parent == this) {
-            ERROR("Cycle detected: node is its own parent!");
-        }
-        if (parent) {
-            switch (anchorTop_) {
-                case AnchorPoint::TOP_LEFT:
-                case AnchorPoint::TOP_CENTER:
-                case AnchorPoint::TOP_RIGHT:
-                    return parent->getTop() + top_;
-                case AnchorPoint::MIDDLE_LEFT:
-                case AnchorPoint::MIDDLE_CENTER:
-                case AnchorPoint::MIDDLE_RIGHT:
-                    return parent->getTop() + parent->getHeight() / 2 + top_;
-                case AnchorPoint::BOTTOM_LEFT:
-                case AnchorPoint::BOTTOM_CENTER:
-                case AnchorPoint::BOTTOM_RIGHT:
-                    return parent->getTop() + parent->getHeight() + top_;
-            }
-        }
-        return top_; // root node or no parent
+        if (worldBoundsDirty_) updateWorldBounds_();
+        return worldBounds_.top;
     }
 
     float IDisplayObject::getBottom() const
+    {
+        if (worldBoundsDirty_) updateWorldBounds_();
+        return worldBounds_.bottom;
+    }
+
+    // World Bounds Cache
+
+    void IDisplayObject::updateWorldBounds_() const
     {
         auto* parent = dynamic_cast<IDisplayObject*>(parent_.get());
-        if (parent == this) {
+        if (parent == this) 
+        {
             ERROR("Cycle detected: node is its own parent!");
         }
-        if (parent) {
-            switch (anchorBottom_) {
-                case AnchorPoint::TOP_LEFT:
+        if (!parent || parent == this) 
+        {
+            // root node or no parent
+            worldBounds_ = { left_, top_, right_, bottom_ };
+            worldBoundsDirty_ = false;
+            return;
+        }
+
+        // The parent's edges come from its own cache, so each ancestor is
+        // resolved at most once no matter how deep the tree is.
+        const float parentLeft = parent->getLeft();
+        const float parentTop = parent->getTop();
+        const int parentWidth = parent->getWidth();
+        const int parentHeight = parent->getHeight();
+
+        auto anchorX = [&](AnchorPoint ap) -> float
+        {
+            switch (ap) 
+            {
                 case AnchorPoint::TOP_CENTER:
+                case AnchorPoint::MIDDLE_CENTER:
+                case AnchorPoint::BOTTOM_CENTER:
+                    return parentLeft + parentWidth / 2;
                 case AnchorPoint::TOP_RIGHT:
-                    return parent->getTop() + bottom_;
+                case AnchorPoint::MIDDLE_RIGHT:
+                case AnchorPoint::BOTTOM_RIGHT:
+                    return parentLeft + parentWidth;
+                default:
+                    return parentLeft;
+            }
+        };
+        auto anchorY = [&](AnchorPoint ap) -> float
+        {
+            switch (ap) 
+            {
                 case AnchorPoint::MIDDLE_LEFT:
                 case AnchorPoint::MIDDLE_CENTER:
                 case AnchorPoint::MIDDLE_RIGHT:
-                    return parent->getTop() + parent->getHeight() / 2 + bottom_;
+                    return parentTop + parentHeight / 2;
                 case AnchorPoint::BOTTOM_LEFT:
                 case AnchorPoint::BOTTOM_CENTER:
                 case AnchorPoint::BOTTOM_RIGHT:
-                    return parent->getTop() + parent->getHeight() + bottom_;
+                    return parentTop + parentHeight;
+                default:
+                    return parentTop;
             }
+        };
+
+        worldBounds_.left = anchorX(anchorLeft_) + left_;
+        worldBounds_.right = anchorX(anchorRight_) + right_;
+        worldBounds_.top = anchorY(anchorTop_) + top_;
+        worldBounds_.bottom = anchorY(anchorBottom_) + bottom_;
+        worldBoundsDirty_ = false;
+    } // END: updateWorldBounds_()
+
+    void IDisplayObject::invalidateWorldBounds()
+    {
+        // A clean node always has clean ancestors, so a node that is already
+        // stale implies its whole subtree is stale as well.
+        if (worldBoundsDirty_) return;
+        worldBoundsDirty_ = true;
+        getCore().getEventManager().markHitBoundsDirty(this);
+        for (auto& child : children_)
+        {
+            IDisplayObject* childObj = child.get();
+            if (childObj && childObj != this)
+                childObj->invalidateWorldBounds();
         }
-        return bottom_; // root node or no parent
-    }
+    } // END: invalidateWorldBounds()
 
     // Main Edge Setters    
 
@@ -1594,6 +1692,7 @@ namespace SDOM
             }
         }
         left_ = p_left - parentAnchor;
+        invalidateWorldBounds();
         setDirty();
         return *this;
     }
@@ -1625,6 +1724,7 @@ namespace SDOM
             }
         }
         right_ = p_right - parentAnchor;
+        invalidateWorldBounds();
         setDirty();
         return *this;
     }
@@ -1658,6 +1758,7 @@ namespace SDOM
             }
         }
         top_ = p_top - parentAnchor;
+        invalidateWorldBounds();
         setDirty();
         return *this;
     }
@@ -1692,6 +1793,7 @@ namespace SDOM
             }
         }
         bottom_ = p_bottom - parentAnchor;
+        invalidateWorldBounds();
         setDirty();
         return *this;
     }
@@ -138,7 +138,8 @@ namespace SDOM
     void IPanelObject::onUnload()
     {
         // Drop cached renderer-owned resources; avoid SDL_Destroy during teardown
-        if (cachedTexture_) { cachedTexture_ = nullptr; }
+        getCore().getTexturePool().release(cacheLease_);
+        cachedTexture_ = nullptr;
         current_width_ = 0;
         current_height_ = 0;
         current_pixel_format_ = SDL_PIXELFORMAT_UNKNOWN;
@@ -151,14 +152,10 @@ namespace SDOM
     {
         // Release any renderer-owned resources so device rebuilds don't leave
         // stale textures around. Factory manages asset lifetimes separately.
-        if (cachedTexture_)
-        {
-            // If renderer is unavailable (e.g., being torn down), avoid
-            // destroying a texture tied to a dead device. Just drop pointer.
-            if (getRenderer())
-                SDL_DestroyTexture(cachedTexture_);
-            cachedTexture_ = nullptr;
-        }
+        // Releasing never calls SDL, so this is safe while the renderer is
+        // being torn down; the pool owns the texture either way.
+        getCore().getTexturePool().release(cacheLease_);
+        cachedTexture_ = nullptr;
         current_width_ = 0;
         current_height_ = 0;
         current_pixel_format_ = SDL_PIXELFORMAT_UNKNOWN;
@@ -174,10 +171,10 @@ namespace SDOM
     // those cases; invalidate and mark dirty so onRender() rebuilds next frame.
     void IPanelObject::onWindowResize(int /*logicalWidth*/, int /*logicalHeight*/)
     {
-        // Do not destroy here — during device transitions the texture pointer
-        // may belong to a previous renderer. Simply drop the reference and
-        // let the renderer lifecycle clean up safely.
-        if (cachedTexture_) { cachedTexture_ = nullptr; }
+        // Hand the texture back to the pool rather than destroying it; after a
+        // device transition the pool has already dropped it and this is a no-op.
+        getCore().getTexturePool().release(cacheLease_);
+        cachedTexture_ = nullptr;
         current_width_ = 0;
         current_height_ = 0;
         current_pixel_format_ = SDL_PIXELFORMAT_UNKNOWN;
@@ -197,6 +194,11 @@ namespace SDOM
         SDL_Renderer* renderer = getRenderer();
         if (!renderer) { ERROR("IPanelObject::onRender: renderer is null"); return; }
 
+        // Follow the cache if the texture pool moved it; repaint if it was lost
+        if (!getCore().getTexturePool().sync(cacheLease_))
+            setDirty(true);
+        cachedTexture_ = cacheLease_.texture;
+
         // Avoid per-frame texture validity queries; onWindowResize() already
         // clears our cache, and we also guard below if the renderer changed.
         // If format/size changed since last build, force a rebuild.
@@ -222,7 +224,9 @@ namespace SDOM
 
                 try { ss->load(); } catch(...) {}
                 SDL_Color color = getColor();
-                ss->drawNineQuad(static_cast<int>(base_index_), cachedTexture_, color, SDL_SCALEMODE_NEAREST);
+                TexturePool::Target target(renderer, cacheLease_);
+                ss->drawNineQuad(static_cast<int>(base_index_), cachedTexture_, color, SDL_SCALEMODE_NEAREST,
+                                 cacheLease_.width, cacheLease_.height);
             }
             setDirty(false);
         }
@@ -233,7 +237,7 @@ namespace SDOM
             // Renderer changed since cache creation; drop and rebuild next frame.
             if (cached_renderer_ && cached_renderer_ != renderer)
             {
-                SDL_DestroyTexture(cachedTexture_);
+                getCore().getTexturePool().release(cacheLease_);
                 cachedTexture_ = nullptr;
                 setDirty(true);
                 return;
@@ -242,7 +246,7 @@ namespace SDOM
             float tw = 0.0f, th = 0.0f;
             if (!SDL_GetTextureSize(cachedTexture_, &tw, &th))
             {
-                SDL_DestroyTexture(cachedTexture_);
+                getCore().getTexturePool().release(cacheLease_);
                 cachedTexture_ = nullptr;
                 setDirty(true);
                 return;
@@ -253,13 +257,14 @@ namespace SDOM
                 static_cast<float>(getWidth()),
                 static_cast<float>(getHeight())
             };
-            if (!SDL_RenderTexture(renderer, cachedTexture_, nullptr, &dst))
+            // Pooled textures may be larger than the panel; blit only its part
+            SDL_FRect src = cacheLease_.srcRect();
+            if (!getCore().getRenderCommands().texturedQuad(cachedTexture_, &src, dst))
             {
-                std::string err = SDL_GetError();
-                ERROR("IPanelObject::onRender: failed to render cached panel texture: " + err);
+                DEBUG_LOG("IPanelObject::onRender: cached panel texture is no longer drawable; rebuilding");
                 // If the texture was tied to a previous renderer, drop and rebuild
                 // next frame rather than crashing or spamming errors.
-                SDL_DestroyTexture(cachedTexture_);
+                getCore().getTexturePool().release(cacheLease_);
                 cachedTexture_ = nullptr;
                 setDirty(true);
                 return;
@@ -267,7 +272,8 @@ namespace SDOM
         }
         else
         {
-            // Fallback: draw live if caching unavailable
+            // Fallback: draw live if caching unavailable (direct SDL, so flush first)
+            getCore().getRenderCommands().flush();
             renderPanel();
         }
     } // END: void IPanelObject::onRender() 
@@ -357,65 +363,27 @@ namespace SDOM
 
     bool IPanelObject::rebuildPanelTexture_(int width, int height, SDL_PixelFormat fmt)
     {
-        // Destroy and recreate if format/size changed
-        bool needCreate = false;
-        if (!cachedTexture_)
-        {
-            needCreate = true;
-        }
-        else
-        {
-            float tw = 0.0f, th = 0.0f;
-            if (!SDL_GetTextureSize(cachedTexture_, &tw, &th))
-            {
-                // texture became invalid; recreate
-                needCreate = true;
-            }
-            else if (static_cast<int>(tw) != width || static_cast<int>(th) != height || current_pixel_format_ != fmt)
-            {
-                needCreate = true;
-            }
-        }
-
-        if (!needCreate)
-            return true;
-
-        if (cachedTexture_)
+        // Lease from Core's pool; a resize that stays within the same size
+        // bucket keeps the current texture, and a zero size releases it.
+        if (!getCore().getTexturePool().lease(cacheLease_, getRenderer(), width, height, fmt))
         {
-            SDL_DestroyTexture(cachedTexture_);
-            cachedTexture_ = nullptr;
-        }
-
-        if (width <= 0 || height <= 0)
-        {
-            current_pixel_format_ = fmt;
-            current_width_ = width;
-            current_height_ = height;
-            return true; // nothing to create at zero size
+            ERROR("IPanelObject::rebuildPanelTexture_: failed to lease texture: " + std::string(SDL_GetError()));
+            return false;
         }
+        cachedTexture_ = cacheLease_.texture;
 
-        cachedTexture_ = SDL_CreateTexture(getRenderer(), fmt, SDL_TEXTUREACCESS_TARGET, width, height);
+        current_pixel_format_ = fmt;
+        current_width_ = width;
+        current_height_ = height;
         if (!cachedTexture_)
-        {
-            ERROR("IPanelObject::rebuildPanelTexture_: failed to create texture: " + std::string(SDL_GetError()));
-            return false;
-        }
-        if (!SDL_SetTextureBlendMode(cachedTexture_, SDL_BLENDMODE_BLEND))
-        {
-            ERROR("IPanelObject::rebuildPanelTexture_: failed to set texture blend mode: " + std::string(SDL_GetError()));
-            return false;
-        }
-        // Cached panel textures render 1:1; prefer nearest for predictable pixels.
-        SDL_SetTextureScaleMode(cachedTexture_, SDL_SCALEMODE_NEAREST);
+            return true; // nothing to render into at zero size
+
+        // Cached panel textures render 1:1; the pool leaves them BLEND + NEAREST.
         if (!SDL_SetRenderDrawBlendMode(getRenderer(), SDL_BLENDMODE_BLEND))
         {
             ERROR("IPanelObject::rebuildPanelTexture_: failed to set render blend mode: " + std::string(SDL_GetError()));
             return false;
         }
-
-        current_pixel_format_ = fmt;
-        current_width_ = width;
-        current_height_ = height;
         cached_renderer_ = getRenderer();
         return true;
     }
@@ -184,7 +184,8 @@ namespace SDOM
 
     void IRangeControl::onUnload()
     {
-        if (cachedTexture_) { cachedTexture_ = nullptr; }
+        getCore().getTexturePool().release(cacheLease_);
+        cachedTexture_ = nullptr;
         current_width_ = 0;
         current_height_ = 0;
         current_pixel_format_ = SDL_PIXELFORMAT_UNKNOWN;
@@ -194,11 +195,9 @@ namespace SDOM
 
     void IRangeControl::onQuit() 
     {
-        // destroy cached render texture if present
-        if (cachedTexture_) {
-            SDL_DestroyTexture(cachedTexture_);
-            cachedTexture_ = nullptr;
-        }
+        // return the cached render texture to the pool
+        getCore().getTexturePool().release(cacheLease_);
+        cachedTexture_ = nullptr;
         SUPER::onQuit();
     } // END: void IRangeControl::onQuit()
 
@@ -423,55 +422,35 @@ namespace SDOM
     // --- Cached rendering helper --- //
     bool IRangeControl::rebuildRangeTexture_(int width, int height, SDL_PixelFormat fmt)
     {
-        bool needCreate = false;
-        if (!cachedTexture_) {
-            needCreate = true;
-        } else {
-            float tw = 0.0f, th = 0.0f;
-            if (!SDL_GetTextureSize(cachedTexture_, &tw, &th)) {
-                needCreate = true;
-            } else if (static_cast<int>(tw) != width || static_cast<int>(th) != height || current_pixel_format_ != fmt) {
-                needCreate = true;
-            }
-        }
-
-        if (!needCreate) return true;
-
-        if (cachedTexture_) {
-            SDL_DestroyTexture(cachedTexture_);
-            cachedTexture_ = nullptr;
+        // Lease from Core's pool; a resize that stays within the same size
+        // bucket keeps the current texture, and a zero size releases it.
+        if (!getCore().getTexturePool().lease(cacheLease_, getRenderer(), width, height, fmt)) {
+            ERROR("IRangeControl::rebuildRangeTexture_: failed to lease texture: " + std::string(SDL_GetError()));
+            return false;
         }
+        cachedTexture_ = cacheLease_.texture;
 
-        if (width <= 0 || height <= 0) {
-            current_pixel_format_ = fmt;
-            current_width_ = width;
-            current_height_ = height;
-            return true;
-        }
+        current_pixel_format_ = fmt;
+        current_width_ = width;
+        current_height_ = height;
+        if (!cachedTexture_) return true;
 
-        cachedTexture_ = SDL_CreateTexture(getRenderer(), fmt, SDL_TEXTUREACCESS_TARGET, width, height);
-        if (!cachedTexture_) {
-            ERROR("IRangeControl::rebuildRangeTexture_: failed to create texture: " + std::string(SDL_GetError()));
-            return false;
-        }
-        if (!SDL_SetTextureBlendMode(cachedTexture_, SDL_BLENDMODE_BLEND)) {
-            ERROR("IRangeControl::rebuildRangeTexture_: failed to set blend mode: " + std::string(SDL_GetError()));
-            return false;
-        }
+        // Range controls render cached textures 1:1; the pool leaves them BLEND + NEAREST.
         if (!SDL_SetRenderDrawBlendMode(getRenderer(), SDL_BLENDMODE_BLEND)) {
             ERROR("IRangeControl::rebuildRangeTexture_: failed to set renderer blend mode: " + std::string(SDL_GetError()));
             return false;
         }
-        // Range controls render cached textures 1:1; keep scaling nearest.
-        SDL_SetTextureScaleMode(cachedTexture_, SDL_SCALEMODE_NEAREST);
-
-        current_pixel_format_ = fmt;
-        current_width_ = width;
-        current_height_ = height;
         cached_renderer_ = getRenderer();
         return true;
     }
 
+    void IRangeControl::syncRangeTexture_()
+    {
+        if (!getCore().getTexturePool().sync(cacheLease_))
+            setDirty(true);
+        cachedTexture_ = cacheLease_.texture;
+    }
+
     // Cached-texture + window-resize contract
     //
     // Range controls that cache a render texture must drop and rebuild it
@@ -479,8 +458,9 @@ namespace SDOM
     // and on SDL resize events. Clear the cache, reset trackers, set dirty.
     void IRangeControl::onWindowResize(int /*logicalWidth*/, int /*logicalHeight*/)
     {
-        // Drop reference only; avoid destroying during renderer transitions
-        if (cachedTexture_) { cachedTexture_ = nullptr; }
+        // Release never calls SDL, so it is safe during renderer transitions
+        getCore().getTexturePool().release(cacheLease_);
+        cachedTexture_ = nullptr;
         current_width_ = 0;
         current_height_ = 0;
         current_pixel_format_ = SDL_PIXELFORMAT_UNKNOWN;
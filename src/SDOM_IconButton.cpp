@@ -1,6 +1,7 @@
 // SDOM_IconButton.hpp
 
 #include <SDOM/SDOM.hpp>
+#include <SDOM/SDOM_Core.hpp>
 #include <SDOM/SDOM_Factory.hpp>
 #include <SDOM/SDOM_SpriteSheet.hpp>
 #include <SDOM/SDOM_IconButton.hpp>
@@ -173,40 +174,36 @@ namespace SDOM
             static_cast<float>(getHeight()) 
         };
 
+        RenderCommandBuffer& commands = getCore().getRenderCommands();
+
         // Render Background Color
         SDL_Color bgColor = getBackgroundColor();
         if (bgColor.a > 0 && background_)
-        {
-            SDL_SetRenderDrawBlendMode(getRenderer(), SDL_BLENDMODE_BLEND);
-            SDL_SetRenderDrawColor(getRenderer(), bgColor.r, bgColor.g, bgColor.b, bgColor.a);
-            SDL_RenderFillRect(getRenderer(), &dstRect);
-        }
+            commands.fillRect(dstRect, bgColor);
 
         // Render Border Color
         SDL_Color borderColor = getBorderColor();
         if (borderColor.a > 0 && border_)
-        {
-            SDL_SetRenderDrawBlendMode(getRenderer(), SDL_BLENDMODE_BLEND);
-            SDL_SetRenderDrawColor(getRenderer(), borderColor.r, borderColor.g, borderColor.b, borderColor.a);
-            SDL_RenderRect(getRenderer(), &dstRect);
-        }
-
+            commands.outlineRect(dstRect, borderColor);
 
         SpriteSheet* ss = iconSpriteSheet_.as<SpriteSheet>();
-        if (ss && ss->isLoaded())
+        if (ss && ss->isLoaded() && ss->getTexture())
         {
-            SDL_FRect dstRect = {
-                static_cast<float>(getX()),
-                static_cast<float>(getY()),
-                static_cast<float>(getWidth()),
-                static_cast<float>(getHeight())
-            };
-            ss-> drawSprite(
-                 static_cast<int>(icon_index_), // icon index
-                dstRect, 
-                getColor(),
-                SDL_SCALEMODE_NEAREST
-            );
+            const int index = static_cast<int>(icon_index_);
+            if (index >= 0 && index < ss->getSpriteCount())
+            {
+                SDL_FRect srcRect = {
+                    static_cast<float>(ss->getSpriteX(index)),
+                    static_cast<float>(ss->getSpriteY(index)),
+                    static_cast<float>(ss->getSpriteWidth()),
+                    static_cast<float>(ss->getSpriteHeight())
+                };
+                commands.texturedQuad(ss->getTexture(), &srcRect, dstRect, getColor(), SDL_SCALEMODE_NEAREST);
+            }
+            else
+            {
+                ERROR("IconButton::onRender: icon index out of range for '" + getName() + "'");
+            }
         }
 
     } // END: void IconButton::onRender()
@@ -230,7 +230,8 @@ namespace SDOM
 
     void Label::onUnload()
     {
-        if (cachedTexture_) { cachedTexture_ = nullptr; }
+        getCore().getTexturePool().release(cacheLease_);
+        cachedTexture_ = nullptr;
         current_width = 0;
         current_height = 0;
         current_pixel_format = SDL_PIXELFORMAT_UNKNOWN;
@@ -342,9 +343,10 @@ namespace SDOM
     //   - Mark dirty so onRender() will recreate the cache next frame
     void Label::onWindowResize(int /*logicalWidth*/, int /*logicalHeight*/)
     {
-        // Drop the cached texture reference without destroying; renderer may
-        // be in transition and the pointer could belong to a previous device.
-        if (cachedTexture_) { cachedTexture_ = nullptr; }
+        // Hand the cached texture back to the pool without destroying it;
+        // the renderer may be in transition (the pool ignores stale leases).
+        getCore().getTexturePool().release(cacheLease_);
+        cachedTexture_ = nullptr;
         current_width = 0;
         current_height = 0;
         current_pixel_format = SDL_PIXELFORMAT_UNKNOWN;
@@ -355,13 +357,20 @@ namespace SDOM
     void Label::onRender() 
     {       
         SDL_Renderer* renderer = getRenderer();
-        SDL_Texture* target = SDL_GetRenderTarget(renderer);
+
+        // Follow the cache if the texture pool moved it; repaint if it was lost
+        if (!getCore().getTexturePool().sync(cacheLease_))
+            setDirty(true);
+        cachedTexture_ = cacheLease_.texture;
 
         // Drop cache if texture became invalid or belongs to a previous renderer
         if (cachedTexture_)
         {
             if (SDOM::drop_invalid_cached_texture(cachedTexture_, renderer, cached_renderer_))
+            {
+                getCore().getTexturePool().release(cacheLease_);
                 setDirty(true);
+            }
         }
 
         if (isDirty()) 
@@ -374,13 +383,13 @@ namespace SDOM
             // If we don't have a cached texture (e.g., size is 0x0), skip rendering this frame
             if (cachedTexture_) 
             {
-                if (!SDL_SetRenderTarget(renderer, cachedTexture_)) 
+                // Bind our (possibly shared) area of the texture, cleared to transparent
+                TexturePool::Target target(renderer, cacheLease_);
+                if (!target) 
                 {
                     ERROR("Label::onRender -- Unable to set render target: " + std::string(SDL_GetError()));
                     return;
                 }
-                SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
-                SDL_RenderClear(renderer);
                 // Pass 1: render background
                 SDL_Color bgndColor = backgroundColor_;
                 if (bgndColor.a > 0 && defaultStyle_.background) 
@@ -401,7 +410,6 @@ namespace SDOM
                 }
                 // Render the Label
                 renderLabel();
-                SDL_SetRenderTarget(renderer, target);
             }
             // Mark clean even if we skipped rendering due to zero-sized texture
             setDirty(false);
@@ -413,7 +421,7 @@ namespace SDOM
             // If renderer changed since cache creation, drop and rebuild
             if (cached_renderer_ && cached_renderer_ != renderer)
             {
-                SDL_DestroyTexture(cachedTexture_);
+                getCore().getTexturePool().release(cacheLease_);
                 cachedTexture_ = nullptr;
                 setDirty(true);
                 return;
@@ -426,11 +434,12 @@ namespace SDOM
                 static_cast<float>(getWidth()),
                 static_cast<float>(getHeight())
             };
-            if (!SDL_RenderTexture(renderer, cachedTexture_, nullptr, &dst)) 
+            SDL_FRect src = cacheLease_.srcRect();   // pooled textures may be larger
+            if (!getCore().getRenderCommands().texturedQuad(cachedTexture_, &src, dst))
             {
-                ERROR("Label::onRender() -- Unable to render to texture: " + std::string(SDL_GetError()));
+                DEBUG_LOG("Label::onRender() -- cached texture is no longer drawable; rebuilding");
                 // If texture and renderer mismatch, drop and rebuild next frame
-                SDL_DestroyTexture(cachedTexture_);
+                getCore().getTexturePool().release(cacheLease_);
                 cachedTexture_ = nullptr;
                 setDirty(true);
                 return;
@@ -948,6 +957,8 @@ namespace SDOM
 
     void Label::renderLabel()
     {
+        // Glyph quads from all three passes share one sprite batch
+        SpriteBatch::Scope batchScope(getCore().getSpriteBatch());
         renderLabelPass(RenderPass::Dropshadow);
         renderLabelPass(RenderPass::Outline);
         renderLabelPass(RenderPass::Foreground);
@@ -1646,40 +1657,26 @@ if (LABEL_DEBUG)
         if (!needsTextureRebuild_(width, height, fmt))
             return true;
 
-        // Always destroy old texture if dimensions/pixel format changed
-        if (cachedTexture_) {
-            SDL_DestroyTexture(cachedTexture_);
-            cachedTexture_ = nullptr;
+        // Lease from Core's pool; a resize within the same size bucket keeps
+        // the current texture, and a zero size releases it without thrashing.
+        if (!getCore().getTexturePool().lease(cacheLease_, getRenderer(), width, height, fmt)) {
+            ERROR("Label::rebuildTexture_() -- Failed to lease resized texture: " + std::string(SDL_GetError()));
+            return false;
         }
-
-        // If target size is zero in either dimension, do not create a texture.
-        // Just update internal state to avoid thrashing and return success.
-        if (width <= 0 || height <= 0) {
+        cachedTexture_ = cacheLease_.texture;
+        if (!cachedTexture_) {
             current_pixel_format = fmt;
             current_width = width;
             current_height = height;
             // Do NOT set dirty here; caller will clear it for this frame.
             return true;
         }
-
-        // Create new texture
-        cachedTexture_ = SDL_CreateTexture(getRenderer(), fmt, SDL_TEXTUREACCESS_TARGET, width, height);
-        if (!cachedTexture_) {
-            ERROR("Label::rebuildTexture_() -- Failed to create resized texture: " + std::string(SDL_GetError()));
-            return false;
-        }
-        if (!SDL_SetTextureBlendMode(cachedTexture_, SDL_BLENDMODE_BLEND))
-        {
-            ERROR("Label::rebuildTexture_() -- Failed to set texture blend mode: " +std::string(SDL_GetError()));
-            return false;
-        }
+        // The pool leaves leased textures BLEND + NEAREST (labels blit 1:1)
         if (!SDL_SetRenderDrawBlendMode(getRenderer(), SDL_BLENDMODE_BLEND)) 
         {
             ERROR("Label::rebuildTexture_() -- Failed to set render draw blend mode: " + std::string(SDL_GetError()));
             return false;
         }
-        // Label cached textures blit 1:1; ensure nearest sampling.
-        SDL_SetTextureScaleMode(cachedTexture_, SDL_SCALEMODE_NEAREST);
 
         // Update current texture info
         current_pixel_format = fmt;
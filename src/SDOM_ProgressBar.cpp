@@ -44,11 +44,17 @@ namespace SDOM
         SDL_Renderer* renderer = getRenderer();
         if (!renderer) { ERROR("ProgressBar::onRender(): renderer is null"); return; }
 
+        // Follow the cache if the texture pool moved it
+        syncRangeTexture_();
+
         // Invalidate cached texture when renderer changes or texture becomes invalid.
         if (cachedTexture_)
         {
             if (SDOM::drop_invalid_cached_texture(cachedTexture_, renderer, cached_renderer_))
+            {
+                getCore().getTexturePool().release(cacheLease_);
                 setDirty(true);
+            }
         }
 
         if (isDirty())
@@ -61,17 +67,15 @@ namespace SDOM
 
             if (cachedTexture_)
             {
-                SDL_Texture* prev = SDL_GetRenderTarget(renderer);
-                if (!SDL_SetRenderTarget(renderer, cachedTexture_))
+                // Bind our (possibly shared) area of the texture, cleared to transparent;
+                // the previous target is restored when `target` goes out of scope
+                TexturePool::Target target(renderer, cacheLease_);
+                if (!target)
                 {
                     ERROR("ProgressBar::onRender(): unable to set target");
                     return;
                 }
 
-                // Clear to transparent
-                SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
-                SDL_RenderClear(renderer);
-
                 float ss_width = ss->getSpriteWidth();
                 float ss_height = ss->getSpriteHeight();
                 float scale_width = ss_width / 8.0f;
@@ -186,7 +190,6 @@ namespace SDOM
                     );
                 }
 
-                SDL_SetRenderTarget(renderer, prev);
                 // Track which renderer created this cache
                 cached_renderer_ = renderer;
             }
@@ -196,15 +199,28 @@ namespace SDOM
 
         if (cachedTexture_)
         {
+            // Renderer changed since cache creation; drop and rebuild next frame.
+            if (cached_renderer_ && cached_renderer_ != renderer)
+            {
+                getCore().getTexturePool().release(cacheLease_);
+                cachedTexture_ = nullptr;
+                setDirty(true);
+                return;
+            }
             SDL_FRect dst = {
                 static_cast<float>(getX()),
                 static_cast<float>(getY()),
                 static_cast<float>(getWidth()),
                 static_cast<float>(getHeight())
             };
-            if (!SDL_RenderTexture(renderer, cachedTexture_, nullptr, &dst))
+            SDL_FRect src = cacheLease_.srcRect();   // pooled textures may be larger
+            if (!getCore().getRenderCommands().texturedQuad(cachedTexture_, &src, dst))
             {
-                ERROR("ProgressBar::onRender(): failed to render cache: " + std::string(SDL_GetError()));
+                DEBUG_LOG("ProgressBar::onRender(): cached texture is no longer drawable; rebuilding");
+                getCore().getTexturePool().release(cacheLease_);
+                cachedTexture_ = nullptr;
+                setDirty(true);
+                return;
             }
         }
     } // END: void ProgressBar::onRender()
@@ -0,0 +1,334 @@
+// SDOM_RenderCommandBuffer.cpp
+
+#include <SDOM/SDOM.hpp>
+#include <SDOM/SDOM_RenderCommandBuffer.hpp>
+
+#include <algorithm>
+
+namespace SDOM
+{
+    // --- Frame Control --- //
+
+    void RenderCommandBuffer::begin(SDL_Renderer* renderer, SDL_Texture* target)
+    {
+        if (recording_) end();
+        renderer_ = renderer;
+        target_ = target;
+        recording_ = (renderer != nullptr);
+        clipTouched_ = false;
+        commands_.clear();
+        frameStart_ = stats_;
+    } // END: RenderCommandBuffer::begin()
+
+    void RenderCommandBuffer::flush()
+    {
+        if (commands_.empty() || !renderer_)
+        {
+            commands_.clear();
+            return;
+        }
+
+        SDL_Texture* current = SDL_GetRenderTarget(renderer_);
+        const bool switched = (current != target_);
+        if (switched) SDL_SetRenderTarget(renderer_, target_);
+
+        // Clip changes split the stream into independently sorted segments
+        std::size_t segStart = 0;
+        for (std::size_t i = 0; i < commands_.size(); ++i)
+        {
+            if (commands_[i].kind != Kind::SetClip) continue;
+            submitSegment_(segStart, i);
+            execute_(commands_[i]);
+            segStart = i + 1;
+        }
+        submitSegment_(segStart, commands_.size());
+
+        if (switched) SDL_SetRenderTarget(renderer_, current);
+        commands_.clear();
+    } // END: RenderCommandBuffer::flush()
+
+    void RenderCommandBuffer::discard()
+    {
+        commands_.clear();
+    } // END: RenderCommandBuffer::discard()
+
+    void RenderCommandBuffer::end()
+    {
+        if (!recording_) return;
+        flush();
+        if (clipTouched_ && renderer_)
+            SDL_SetRenderClipRect(renderer_, nullptr);
+        recording_ = false;
+
+        lastFrame_.recorded  = stats_.recorded  - frameStart_.recorded;
+        lastFrame_.submitted = stats_.submitted - frameStart_.submitted;
+        lastFrame_.merged    = stats_.merged    - frameStart_.merged;
+        lastFrame_.reordered = stats_.reordered - frameStart_.reordered;
+    } // END: RenderCommandBuffer::end()
+
+    void RenderCommandBuffer::setTarget(SDL_Texture* target)
+    {
+        flush();
+        target_ = target;
+    } // END: RenderCommandBuffer::setTarget()
+
+    void RenderCommandBuffer::reset()
+    {
+        commands_.clear();
+        quadBatch_.reset();
+        renderer_ = nullptr;
+        target_ = nullptr;
+        recording_ = false;
+        clipTouched_ = false;
+    } // END: RenderCommandBuffer::reset()
+
+
+    // --- Recording --- //
+
+    void RenderCommandBuffer::fillRect(const SDL_FRect& rect, SDL_Color color, SDL_BlendMode blend)
+    {
+        Command cmd;
+        cmd.kind = Kind::FillRect;
+        cmd.dst = rect;
+        cmd.color = color;
+        cmd.blendMode = blend;
+        record_(cmd);
+    } // END: RenderCommandBuffer::fillRect()
+
+    void RenderCommandBuffer::outlineRect(const SDL_FRect& rect, SDL_Color color, SDL_BlendMode blend)
+    {
+        Command cmd;
+        cmd.kind = Kind::OutlineRect;
+        cmd.dst = rect;
+        cmd.color = color;
+        cmd.blendMode = blend;
+        record_(cmd);
+    } // END: RenderCommandBuffer::outlineRect()
+
+    bool RenderCommandBuffer::texturedQuad(SDL_Texture* texture, const SDL_FRect* src, const SDL_FRect& dst, SDL_Color tint)
+    {
+        if (!texture) return false;
+        SDL_ScaleMode mode = SDL_SCALEMODE_LINEAR;
+        SDL_GetTextureScaleMode(texture, &mode);
+        return texturedQuad(texture, src, dst, tint, mode);
+    } // END: RenderCommandBuffer::texturedQuad()
+
+    bool RenderCommandBuffer::texturedQuad(SDL_Texture* texture, const SDL_FRect* src, const SDL_FRect& dst,
+                                           SDL_Color tint, SDL_ScaleMode scaleMode)
+    {
+        if (!texture) return false;
+
+        // A texture created by a previous renderer would only fail later, at
+        // submission, where its owner can no longer react. Refuse it here.
+        SDL_Renderer* renderer = recording_ ? renderer_ : getRenderer();
+        if (!renderer || SDL_GetRendererFromTexture(texture) != renderer)
+            return false;
+
+        Command cmd;
+        cmd.kind = Kind::TexturedQuad;
+        cmd.texture = texture;
+        cmd.dst = dst;
+        if (src) cmd.src = *src;
+        cmd.color = tint;
+        cmd.scaleMode = scaleMode;
+        SDL_GetTextureBlendMode(texture, &cmd.blendMode);
+        record_(cmd);
+        return true;
+    } // END: RenderCommandBuffer::texturedQuad(scaleMode)
+
+    void RenderCommandBuffer::setClip(const SDL_Rect* clip)
+    {
+        Command cmd;
+        cmd.kind = Kind::SetClip;
+        cmd.clipEnabled = (clip != nullptr);
+        if (clip) cmd.clip = *clip;
+        if (!recording_)
+        {
+            execute_(cmd);
+            return;
+        }
+        commands_.push_back(cmd);
+    } // END: RenderCommandBuffer::setClip()
+
+    void RenderCommandBuffer::record_(const Command& cmd)
+    {
+        ++stats_.recorded;
+        if (!recording_)
+        {
+            execute_(cmd);
+            ++stats_.submitted;
+            return;
+        }
+        commands_.push_back(cmd);
+    } // END: RenderCommandBuffer::record_()
+
+
+    // --- Submission --- //
+
+    void RenderCommandBuffer::submitSegment_(std::size_t begin, std::size_t end)
+    {
+        constexpr std::size_t none = static_cast<std::size_t>(-1);
+        std::size_t groupCount = 0;
+
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            const Command& cmd = commands_[i];
+
+            // Walk back through the most recent groups looking for one with the
+            // same state. Stop at the first group whose pixels this command
+            // would overlap, since jumping ahead of it would change the image.
+            std::size_t target = none;
+            std::size_t scanned = 0;
+            for (std::size_t g = groupCount; g-- > 0 && scanned < REORDER_WINDOW; ++scanned)
+            {
+                if (sameState_(commands_[groups_[g].front()], cmd))
+                {
+                    target = g;
+                    break;
+                }
+                if (intersects_(groupBounds_[g], cmd.dst))
+                    break;
+            }
+
+            if (target != none)
+            {
+                groups_[target].push_back(i);
+                groupBounds_[target] = unite_(groupBounds_[target], cmd.dst);
+                ++stats_.merged;
+                if (target + 1 != groupCount) ++stats_.reordered;
+                continue;
+            }
+
+            if (groups_.size() <= groupCount)
+            {
+                groups_.emplace_back();
+                groupBounds_.emplace_back();
+            }
+            groups_[groupCount].clear();
+            groups_[groupCount].push_back(i);
+            groupBounds_[groupCount] = cmd.dst;
+            ++groupCount;
+        }
+
+        for (std::size_t g = 0; g < groupCount; ++g)
+            issueBatch_(groups_[g]);
+    } // END: RenderCommandBuffer::submitSegment_()
+
+    void RenderCommandBuffer::issueBatch_(const std::vector<std::size_t>& members)
+    {
+        if (members.empty()) return;
+        const Command& head = commands_[members.front()];
+        if (members.size() == 1)
+        {
+            execute_(head);
+            ++stats_.submitted;
+            return;
+        }
+
+        switch (head.kind)
+        {
+            case Kind::FillRect:
+            case Kind::OutlineRect:
+            {
+                rectScratch_.clear();
+                for (std::size_t idx : members)
+                    rectScratch_.push_back(commands_[idx].dst);
+                SDL_SetRenderDrawBlendMode(renderer_, head.blendMode);
+                SDL_SetRenderDrawColor(renderer_, head.color.r, head.color.g, head.color.b, head.color.a);
+                if (head.kind == Kind::FillRect)
+                    SDL_RenderFillRects(renderer_, rectScratch_.data(), static_cast<int>(rectScratch_.size()));
+                else
+                    SDL_RenderRects(renderer_, rectScratch_.data(), static_cast<int>(rectScratch_.size()));
+                break;
+            }
+            case Kind::TexturedQuad:
+            {
+                float texW = 0.0f, texH = 0.0f;
+                SDL_GetTextureSize(head.texture, &texW, &texH);
+                SpriteBatch::Scope scope(quadBatch_);
+                for (std::size_t idx : members)
+                {
+                    const Command& cmd = commands_[idx];
+                    SDL_FRect src = cmd.src;
+                    if (src.w <= 0.0f || src.h <= 0.0f) src = { 0.0f, 0.0f, texW, texH };
+                    quadBatch_.addQuad(renderer_, cmd.texture, src, cmd.dst, cmd.color, cmd.scaleMode);
+                }
+                break;
+            }
+            case Kind::SetClip:
+                break;
+        }
+        ++stats_.submitted;
+    } // END: RenderCommandBuffer::issueBatch_()
+
+    void RenderCommandBuffer::execute_(const Command& cmd)
+    {
+        SDL_Renderer* renderer = recording_ ? renderer_ : getRenderer();
+        if (!renderer) return;
+
+        switch (cmd.kind)
+        {
+            case Kind::FillRect:
+                SDL_SetRenderDrawBlendMode(renderer, cmd.blendMode);
+                SDL_SetRenderDrawColor(renderer, cmd.color.r, cmd.color.g, cmd.color.b, cmd.color.a);
+                SDL_RenderFillRect(renderer, &cmd.dst);
+                break;
+            case Kind::OutlineRect:
+                SDL_SetRenderDrawBlendMode(renderer, cmd.blendMode);
+                SDL_SetRenderDrawColor(renderer, cmd.color.r, cmd.color.g, cmd.color.b, cmd.color.a);
+                SDL_RenderRect(renderer, &cmd.dst);
+                break;
+            case Kind::TexturedQuad:
+            {
+                SDL_SetTextureColorMod(cmd.texture, cmd.color.r, cmd.color.g, cmd.color.b);
+                SDL_SetTextureAlphaMod(cmd.texture, cmd.color.a);
+                SDL_SetTextureScaleMode(cmd.texture, cmd.scaleMode);
+                const bool whole = (cmd.src.w <= 0.0f || cmd.src.h <= 0.0f);
+                if (!SDL_RenderTexture(renderer, cmd.texture, whole ? nullptr : &cmd.src, &cmd.dst))
+                    DEBUG_LOG(std::string("RenderCommandBuffer: SDL_RenderTexture failed: ") + SDL_GetError());
+                break;
+            }
+            case Kind::SetClip:
+                SDL_SetRenderClipRect(renderer, cmd.clipEnabled ? &cmd.clip : nullptr);
+                clipTouched_ = true;
+                break;
+        }
+    } // END: RenderCommandBuffer::execute_()
+
+
+    // --- Helpers --- //
+
+    bool RenderCommandBuffer::sameState_(const Command& a, const Command& b)
+    {
+        if (a.kind != b.kind || a.blendMode != b.blendMode) return false;
+        switch (a.kind)
+        {
+            case Kind::FillRect:
+            case Kind::OutlineRect:
+                return a.color.r == b.color.r && a.color.g == b.color.g &&
+                       a.color.b == b.color.b && a.color.a == b.color.a;
+            case Kind::TexturedQuad:
+                // Tint travels per vertex, so only the texture and sampling must match
+                return a.texture == b.texture && a.scaleMode == b.scaleMode;
+            case Kind::SetClip:
+                return false;
+        }
+        return false;
+    } // END: RenderCommandBuffer::sameState_()
+
+    bool RenderCommandBuffer::intersects_(const SDL_FRect& a, const SDL_FRect& b)
+    {
+        return a.x < b.x + b.w && b.x < a.x + a.w &&
+               a.y < b.y + b.h && b.y < a.y + a.h;
+    } // END: RenderCommandBuffer::intersects_()
+
+    SDL_FRect RenderCommandBuffer::unite_(const SDL_FRect& a, const SDL_FRect& b)
+    {
+        const float x0 = std::min(a.x, b.x);
+        const float y0 = std::min(a.y, b.y);
+        const float x1 = std::max(a.x + a.w, b.x + b.w);
+        const float y1 = std::max(a.y + a.h, b.y + b.h);
+        return SDL_FRect{ x0, y0, x1 - x0, y1 - y0 };
+    } // END: RenderCommandBuffer::unite_()
+
+} // END: namespace SDOM
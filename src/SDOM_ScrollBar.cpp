@@ -360,6 +360,9 @@ namespace SDOM
         SDL_Renderer* renderer = getRenderer();
         if (!renderer) { ERROR("ScrollBar::onRender(): renderer is null"); return; }
 
+        // Follow the cache if the texture pool moved it
+        syncRangeTexture_();
+
         // Invalidate cache when renderer changes or texture becomes invalid
         // Skip per-frame validity query; rely on onWindowResize() and the
         // renderer-change guard when drawing to handle invalidation.
@@ -374,17 +377,15 @@ namespace SDOM
 
             if (cachedTexture_)
             {
-                SDL_Texture* prev = SDL_GetRenderTarget(renderer);
-                if (!SDL_SetRenderTarget(renderer, cachedTexture_))
+                // Bind our (possibly shared) area of the texture, cleared to transparent;
+                // the previous target is restored when `target` goes out of scope
+                TexturePool::Target target(renderer, cacheLease_);
+                if (!target)
                 {
                     ERROR("ScrollBar::onRender(): unable to set target");
                     return;
                 }
 
-                // Clear to transparent
-                SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
-                SDL_RenderClear(renderer);
-
                 float ss_width = ss->getSpriteWidth();
                 float ss_height = ss->getSpriteHeight();
                 float scale_width = ss_width / 8.0f;
@@ -499,7 +500,6 @@ namespace SDOM
                     }
                 }
 
-                SDL_SetRenderTarget(renderer, prev);
                 // Track which renderer created this cache
                 cached_renderer_ = renderer;
             }
@@ -516,9 +516,14 @@ namespace SDOM
                 static_cast<float>(getWidth()),
                 static_cast<float>(getHeight())
             };
-            if (!SDL_RenderTexture(renderer, cachedTexture_, nullptr, &dst))
+            SDL_FRect src = cacheLease_.srcRect();   // pooled textures may be larger
+            if (!getCore().getRenderCommands().texturedQuad(cachedTexture_, &src, dst))
             {
-                ERROR("ScrollBar::onRender(): failed to render cache: " + std::string(SDL_GetError()));
+                DEBUG_LOG("ScrollBar::onRender(): cached texture is no longer drawable; rebuilding");
+                getCore().getTexturePool().release(cacheLease_);
+                cachedTexture_ = nullptr;
+                setDirty(true);
+                return;
             }
         }
     } // END: void ScrollBar::onRender()
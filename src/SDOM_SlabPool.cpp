@@ -0,0 +1,160 @@
+// SDOM_SlabPool.cpp
+
+#include <SDOM/SDOM.hpp>
+#include <SDOM/SDOM_SlabPool.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+
+namespace SDOM
+{
+    SlabPool::~SlabPool()
+    {
+        for (auto& [size, sc] : classes_)
+            release_(sc);
+    } // END: SlabPool::~SlabPool()
+
+    SlabPool& SlabPool::displayObjects()
+    {
+        static SlabPool* pool = new SlabPool();
+        return *pool;
+    } // END: SlabPool::displayObjects()
+
+    void* SlabPool::allocate(std::size_t size)
+    {
+        const std::size_t bs = blockSize(std::max<std::size_t>(size, sizeof(FreeBlock)));
+        if (bs > MAX_BLOCK_SIZE)
+        {
+            ++heapFallbacks_;
+            return ::operator new(size);
+        }
+
+        SizeClass& sc = (last_ && last_->blockSize == bs) ? *last_ : sizeClass_(bs);
+        last_ = &sc;
+        if (!sc.freeList)
+            grow_(sc, sc.slabBlocks);
+
+        FreeBlock* block = sc.freeList;
+        sc.freeList = block->next;
+        ++sc.live;
+        ++sc.allocations;
+        return block;
+    } // END: SlabPool::allocate()
+
+    void SlabPool::deallocate(void* ptr, std::size_t size) noexcept
+    {
+        if (!ptr) return;
+        const std::size_t bs = blockSize(std::max<std::size_t>(size, sizeof(FreeBlock)));
+        if (bs > MAX_BLOCK_SIZE)
+        {
+            ::operator delete(ptr);
+            return;
+        }
+
+        // trim() keeps every size class with live blocks, so a miss means the
+        // block (or its size) did not come from this pool. Handing a slab block
+        // to ::operator delete would be undefined; leak it instead.
+        auto it = classes_.find(bs);
+        assert(it != classes_.end() && "SlabPool::deallocate: block is not from this pool");
+        if (it == classes_.end())
+            return;
+        SizeClass& sc = it->second;
+        FreeBlock* block = static_cast<FreeBlock*>(ptr);
+        block->next = sc.freeList;
+        sc.freeList = block;
+        --sc.live;
+    } // END: SlabPool::deallocate()
+
+    void SlabPool::reserve(std::size_t size, std::size_t count)
+    {
+        const std::size_t bs = blockSize(std::max<std::size_t>(size, sizeof(FreeBlock)));
+        if (count == 0 || bs > MAX_BLOCK_SIZE) return;
+        SizeClass& sc = sizeClass_(bs);
+        const std::size_t available = sc.capacity - sc.live;
+        if (count > available)
+            grow_(sc, std::max(count - available, sc.slabBlocks));
+    } // END: SlabPool::reserve()
+
+    void SlabPool::trim()
+    {
+        for (auto it = classes_.begin(); it != classes_.end(); )
+        {
+            if (it->second.live != 0)
+            {
+                ++it;
+                continue;
+            }
+            if (last_ == &it->second) last_ = nullptr;
+            release_(it->second);
+            it = classes_.erase(it);
+        }
+    } // END: SlabPool::trim()
+
+    SlabPool::Stats SlabPool::getStats() const
+    {
+        Stats stats;
+        stats.sizeClasses = classes_.size();
+        stats.heapFallbacks = heapFallbacks_;
+        for (const auto& [bs, sc] : classes_)
+        {
+            stats.slabs += sc.slabs.size();
+            stats.slabBytes += sc.capacity * sc.blockSize;
+            stats.capacity += sc.capacity;
+            stats.live += sc.live;
+            stats.allocations += sc.allocations;
+        }
+        return stats;
+    } // END: SlabPool::getStats()
+
+    SlabPool::Stats SlabPool::getStats(std::size_t size) const
+    {
+        Stats stats;
+        auto it = classes_.find(blockSize(std::max<std::size_t>(size, sizeof(FreeBlock))));
+        if (it == classes_.end()) return stats;
+        const SizeClass& sc = it->second;
+        stats.sizeClasses = 1;
+        stats.slabs = sc.slabs.size();
+        stats.slabBytes = sc.capacity * sc.blockSize;
+        stats.capacity = sc.capacity;
+        stats.live = sc.live;
+        stats.allocations = sc.allocations;
+        return stats;
+    } // END: SlabPool::getStats(size)
+
+    SlabPool::SizeClass& SlabPool::sizeClass_(std::size_t bs)
+    {
+        SizeClass& sc = classes_[bs];
+        if (sc.blockSize == 0)
+        {
+            sc.blockSize = bs;
+            sc.slabBlocks = std::max(MIN_SLAB_BLOCKS, SLAB_BYTES / bs);
+        }
+        return sc;
+    } // END: SlabPool::sizeClass_()
+
+    void SlabPool::grow_(SizeClass& sc, std::size_t blocks)
+    {
+        std::byte* base = static_cast<std::byte*>(::operator new(blocks * sc.blockSize));
+        sc.slabs.emplace_back(base, blocks);
+        sc.capacity += blocks;
+
+        // Thread back to front so allocation walks the slab in address order
+        for (std::size_t i = blocks; i-- > 0; )
+        {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(base + i * sc.blockSize);
+            block->next = sc.freeList;
+            sc.freeList = block;
+        }
+    } // END: SlabPool::grow_()
+
+    void SlabPool::release_(SizeClass& sc)
+    {
+        for (auto& [base, blocks] : sc.slabs)
+            ::operator delete(base);
+        sc.slabs.clear();
+        sc.freeList = nullptr;
+        sc.capacity = 0;
+    } // END: SlabPool::release_()
+
+} // END: namespace SDOM
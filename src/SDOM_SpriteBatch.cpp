@@ -0,0 +1,158 @@
+// SDOM_SpriteBatch.cpp
+
+#include <SDOM/SDOM.hpp>
+#include <SDOM/SDOM_SpriteBatch.hpp>
+
+namespace SDOM
+{
+    void SpriteBatch::begin()
+    {
+        ++depth_;
+    } // END: SpriteBatch::begin()
+
+    void SpriteBatch::end()
+    {
+        if (depth_ <= 0) return;
+        if (--depth_ == 0)
+        {
+            flush();
+            // Forget the state key so a recycled texture address re-queries its size
+            texture_ = nullptr;
+            renderer_ = nullptr;
+        }
+    } // END: SpriteBatch::end()
+
+    void SpriteBatch::addQuad(SDL_Renderer* renderer, SDL_Texture* texture,
+                              const SDL_FRect& src, const SDL_FRect& dst,
+                              SDL_Color color, SDL_ScaleMode scaleMode)
+    {
+        if (!renderer || !texture) return;
+
+        if (!isActive())
+        {
+            // Unbatched: identical to a plain SDL_RenderTexture() call
+            SDL_SetTextureColorMod(texture, color.r, color.g, color.b);
+            SDL_SetTextureAlphaMod(texture, color.a);
+            SDL_SetTextureScaleMode(texture, scaleMode);
+            SDL_RenderTexture(renderer, texture, &src, &dst);
+            ++stats_.quads;
+            ++stats_.drawCalls;
+            return;
+        }
+
+        if (!prepare_(renderer, texture, scaleMode)) return;
+        const SDL_FPoint corners[4] = {
+            { dst.x,         dst.y         },
+            { dst.x + dst.w, dst.y         },
+            { dst.x + dst.w, dst.y + dst.h },
+            { dst.x,         dst.y + dst.h }
+        };
+        pushQuad_(src, corners, color);
+    } // END: SpriteBatch::addQuad(rect)
+
+    void SpriteBatch::addQuad(SDL_Renderer* renderer, SDL_Texture* texture,
+                              const SDL_FRect& src, const SDL_FPoint corners[4],
+                              SDL_Color color, SDL_ScaleMode scaleMode)
+    {
+        if (!renderer || !texture) return;
+        if (!prepare_(renderer, texture, scaleMode)) return;
+        pushQuad_(src, corners, color);
+        if (!isActive())
+        {
+            flush();
+            texture_ = nullptr;
+            renderer_ = nullptr;
+        }
+    } // END: SpriteBatch::addQuad(corners)
+
+    void SpriteBatch::flush()
+    {
+        if (indices_.empty() || !renderer_ || !texture_)
+        {
+            vertices_.clear();
+            indices_.clear();
+            return;
+        }
+
+        // Geometry was recorded against target_; honor it even if the caller has moved on
+        SDL_Texture* current = SDL_GetRenderTarget(renderer_);
+        const bool switched = (current != target_);
+        if (switched) SDL_SetRenderTarget(renderer_, target_);
+
+        // Per-vertex color carries the tint, so the texture mods must be neutral
+        SDL_SetTextureColorMod(texture_, 255, 255, 255);
+        SDL_SetTextureAlphaMod(texture_, 255);
+        SDL_SetTextureScaleMode(texture_, scaleMode_);
+        if (!SDL_RenderGeometry(renderer_, texture_,
+                                vertices_.data(), static_cast<int>(vertices_.size()),
+                                indices_.data(), static_cast<int>(indices_.size())))
+        {
+            ERROR(std::string("SpriteBatch::flush - SDL_RenderGeometry failed: ") + SDL_GetError());
+        }
+        ++stats_.drawCalls;
+
+        if (switched) SDL_SetRenderTarget(renderer_, current);
+        vertices_.clear();
+        indices_.clear();
+    } // END: SpriteBatch::flush()
+
+    void SpriteBatch::reset()
+    {
+        vertices_.clear();
+        indices_.clear();
+        renderer_ = nullptr;
+        texture_ = nullptr;
+        target_ = nullptr;
+    } // END: SpriteBatch::reset()
+
+    bool SpriteBatch::prepare_(SDL_Renderer* renderer, SDL_Texture* texture, SDL_ScaleMode scaleMode)
+    {
+        SDL_Texture* target = SDL_GetRenderTarget(renderer);
+        SDL_BlendMode blend = SDL_BLENDMODE_BLEND;
+        SDL_GetTextureBlendMode(texture, &blend);
+
+        if (renderer != renderer_ || texture != texture_ || target != target_ ||
+            scaleMode != scaleMode_ || blend != blendMode_)
+        {
+            flush();
+            if (renderer != renderer_ || texture != texture_)
+            {
+                if (!SDL_GetTextureSize(texture, &texW_, &texH_))
+                {
+                    texture_ = nullptr;
+                    return false;
+                }
+            }
+            renderer_ = renderer;
+            texture_ = texture;
+            target_ = target;
+            scaleMode_ = scaleMode;
+            blendMode_ = blend;
+        }
+        return texW_ > 0.0f && texH_ > 0.0f;
+    } // END: SpriteBatch::prepare_()
+
+    void SpriteBatch::pushQuad_(const SDL_FRect& src, const SDL_FPoint corners[4], SDL_Color color)
+    {
+        const float u0 = src.x / texW_;
+        const float v0 = src.y / texH_;
+        const float u1 = (src.x + src.w) / texW_;
+        const float v1 = (src.y + src.h) / texH_;
+        const SDL_FColor fc = { color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f };
+
+        const int base = static_cast<int>(vertices_.size());
+        vertices_.push_back({ corners[0], fc, { u0, v0 } });
+        vertices_.push_back({ corners[1], fc, { u1, v0 } });
+        vertices_.push_back({ corners[2], fc, { u1, v1 } });
+        vertices_.push_back({ corners[3], fc, { u0, v1 } });
+
+        indices_.push_back(base + 0);
+        indices_.push_back(base + 1);
+        indices_.push_back(base + 2);
+        indices_.push_back(base + 0);
+        indices_.push_back(base + 2);
+        indices_.push_back(base + 3);
+        ++stats_.quads;
+    } // END: SpriteBatch::pushQuad_()
+
+} // END: namespace SDOM
@@ -597,10 +597,7 @@ namespace SDOM
             restoreTarget();
             return;
         }
-        SDL_SetTextureColorMod(texture_, color.r, color.g, color.b);
-        SDL_SetTextureAlphaMod(texture_, color.a);
-        SDL_SetTextureScaleMode(texture_, scaleMode); 
-        SDL_RenderTexture(renderer, texture_, &srcRect, &destRect);
+        getCore().getSpriteBatch().addQuad(renderer, texture_, srcRect, destRect, color, scaleMode);
 
         restoreTarget();
     }
@@ -684,10 +681,7 @@ namespace SDOM
             restoreTarget();
             return;
         }
-        SDL_SetTextureColorMod(texture_, color.r, color.g, color.b);
-        SDL_SetTextureAlphaMod(texture_, color.a);
-        SDL_SetTextureScaleMode(texture_, scaleMode); 
-        SDL_RenderTexture(renderer, texture_, &srcRect, &destRect);
+        getCore().getSpriteBatch().addQuad(renderer, texture_, srcRect, destRect, color, scaleMode);
 
         restoreTarget();
     }
@@ -791,16 +785,13 @@ namespace SDOM
             restoreTarget();
             return;
         }
-        SDL_SetTextureColorMod(texture_, color.r, color.g, color.b);
-        SDL_SetTextureAlphaMod(texture_, color.a);
-        SDL_SetTextureScaleMode(texture_, scaleMode);
-        SDL_RenderTexture(renderer, texture_, &sRect, &dstRect);
+        getCore().getSpriteBatch().addQuad(renderer, texture_, sRect, dstRect, color, scaleMode);
 
         restoreTarget();
     }   
 
 
-    void SpriteSheet::drawNineQuad(int baseIndex, SDL_Texture* targetTexture, SDL_Color color, SDL_ScaleMode scaleMode)
+    void SpriteSheet::drawNineQuad(int baseIndex, SDL_Texture* targetTexture, SDL_Color color, SDL_ScaleMode scaleMode, int width, int height)
     {
         if (!targetTexture) { ERROR("SpriteSheet::drawNineQuad: targetTexture is null " + debugTextureContext(getTexture())); return; }
 
@@ -822,10 +813,16 @@ namespace SDOM
             SDL_SetRenderTarget(renderer, prevTarget);
             return;
         }
+        if (width > 0) w = std::min(w, static_cast<float>(width));
+        if (height > 0) h = std::min(h, static_cast<float>(height));
 
-        // Clear target to transparent
+        // Clear target to transparent. A fill (not SDL_RenderClear) honors the
+        // viewport, so only the caller's area of a shared texture is touched.
+        const SDL_FRect clearRect{ 0.0f, 0.0f, w, h };
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
-        SDL_RenderClear(renderer);
+        SDL_RenderFillRect(renderer, &clearRect);
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
 
         // Tile dimensions from this spritesheet
         const int cw = spriteWidth_;
@@ -863,6 +860,10 @@ namespace SDOM
             return SDL_FRect{ src_x, src_y, src_w, src_h };
         };
 
+        // Submit all nine tiles as one geometry batch
+        SpriteBatch& batch = getCore().getSpriteBatch();
+        SpriteBatch::Scope batchScope(batch);
+
         // Top-left corner
         drawSprite(idx(0), make_src_for_clipped(fleftW, ftopH, false, false), SDL_FRect{0.0f, 0.0f, fleftW, ftopH}, color, scaleMode);
         // Top-center (stretch horizontally; clip vertically if needed)
@@ -893,6 +894,7 @@ namespace SDOM
         // Bottom-right corner (align src to right+bottom)
         drawSprite(idx(8), make_src_for_clipped(frightW, fbottomH, true, true), SDL_FRect{fleftW + fcenterW, ftopH + fcenterH, frightW, fbottomH}, color, scaleMode);
 
+        batch.flush();
         SDL_SetRenderTarget(renderer, prevTarget);
     }
 
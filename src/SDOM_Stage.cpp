@@ -101,6 +101,21 @@ namespace SDOM
         // Clear the entire window to the border color
         SDL_Color color = getColor();
         SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
+
+        // SDL_RenderClear() ignores the clip rect, so a dirty-rect pass
+        // replaces only the damaged region instead
+        if (SDL_RenderClipEnabled(renderer))
+        {
+            SDL_Rect clip;
+            SDL_GetRenderClipRect(renderer, &clip);
+            SDL_FRect area = { float(clip.x), float(clip.y), float(clip.w), float(clip.h) };
+            SDL_BlendMode previous = SDL_BLENDMODE_BLEND;
+            SDL_GetRenderDrawBlendMode(renderer, &previous);
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+            SDL_RenderFillRect(renderer, &area);
+            SDL_SetRenderDrawBlendMode(renderer, previous);
+            return;
+        }
         SDL_RenderClear(renderer);
     }
 
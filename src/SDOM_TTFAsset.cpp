@@ -95,6 +95,7 @@ namespace SDOM
 
     void TTFAsset::onUnload() 
     {
+        glyphAtlas_.clear();
         if (!ttf_font_) {
             isLoaded_ = false;
             return;
@@ -142,6 +143,41 @@ namespace SDOM
                 return true; // ✅ finished immediately
             });
 
+            // 🔹 2. Glyph atlas rasterizes each glyph variant once
+            ut.add_test(objName, "TTFAsset Glyph Atlas", [this](std::vector<std::string>& errors)
+            {
+                SDL_Renderer* renderer = getRenderer();
+                if (!renderer || !ttf_font_) return true; // nothing to rasterize against
+
+                GlyphAtlas atlas;   // local, so the asset's shared cache is untouched
+                const GlyphAtlas::Variant plain{ static_cast<float>(TTF_GetFontSize(ttf_font_)), TTF_STYLE_NORMAL, 0 };
+                const std::string text = "FPS: 59.94 / 16.68 ms";
+
+                std::unordered_set<Uint32> unique;
+                for (unsigned char c : text)
+                    if (TTF_FontHasGlyph(ttf_font_, c)) unique.insert(c);
+
+                for (int frame = 0; frame < 3; ++frame)
+                    for (unsigned char c : text)
+                        atlas.getGlyph(renderer, ttf_font_, c, plain);
+
+                GlyphAtlas::Stats stats = atlas.getStats();
+                if (stats.rasterized != unique.size())
+                    errors.push_back("Glyph atlas rasterized " + std::to_string(stats.rasterized) +
+                                     " glyphs; expected " + std::to_string(unique.size()));
+                if (stats.pages != 1)
+                    errors.push_back("Glyph atlas expected 1 page, got " + std::to_string(stats.pages));
+
+                // An outline variant is a separate entry
+                const GlyphAtlas::Variant outlined{ plain.ptSize, TTF_STYLE_NORMAL, 1 };
+                atlas.getGlyph(renderer, ttf_font_, 'F', outlined);
+                if (atlas.getStats().rasterized != unique.size() + 1)
+                    errors.push_back("Glyph atlas did not rasterize the outline variant separately");
+
+                TTF_SetFontOutline(ttf_font_, 0);
+                return true; // ✅ finished
+            });
+
             registered = true;
         }
 
@@ -0,0 +1,495 @@
+// SDOM_TexturePool.cpp
+
+#include <SDOM/SDOM.hpp>
+#include <SDOM/SDOM_Core.hpp>
+#include <SDOM/SDOM_TexturePool.hpp>
+
+#include <algorithm>
+#include <bit>
+
+namespace SDOM
+{
+    TexturePool::~TexturePool()
+    {
+        clear();
+    } // END: TexturePool::~TexturePool()
+
+    int TexturePool::bucketSize(int pixels)
+    {
+        if (pixels <= 0) return 0;
+        // Fixed steps for small sizes, ~12.5% steps for large ones
+        const unsigned floorPow2 = std::bit_floor(static_cast<unsigned>(pixels));
+        const int step = std::max(BUCKET_GRANULARITY, static_cast<int>(floorPow2 / 8));
+        return ((pixels + step - 1) / step) * step;
+    } // END: TexturePool::bucketSize()
+
+    bool TexturePool::lease(Lease& lease, SDL_Renderer* renderer, int width, int height, SDL_PixelFormat format,
+                            bool allowAtlas)
+    {
+        if (width <= 0 || height <= 0)
+        {
+            release(lease);
+            return true;
+        }
+        if (!renderer) return false;
+
+        // Textures belong to a single renderer; start over if it changed
+        if (renderer != renderer_)
+        {
+            clear();
+            renderer_ = renderer;
+        }
+
+        // Follow a relocated slot so the checks below see where it lives now
+        sync(lease);
+
+        const int bw = bucketSize(width);
+        const int bh = bucketSize(height);
+        const bool wantSlot = allowAtlas && atlasEnabled_ && bw <= ATLAS_MAX_SLOT && bh <= ATLAS_MAX_SLOT;
+
+        // Keep the current slot while the request stays in its bucket
+        if (lease.texture)
+        {
+            auto slot = slots_.find(lease.id);
+            if (slot != slots_.end() && wantSlot && slot->second.page->format == format &&
+                slot->second.cell.w == bw + 2 * ATLAS_PADDING && slot->second.cell.h == bh + 2 * ATLAS_PADDING)
+            {
+                lease.width = width;
+                lease.height = height;
+                slot->second.page->lastUsed = frame_;
+                ++hits_;
+                return true;
+            }
+        }
+
+        // Keep the current texture while the request stays in its bucket
+        if (lease.texture)
+        {
+            auto it = entries_.find(lease.texture);
+            if (it != entries_.end() && it->second.id == lease.id &&
+                it->second.width == bw && it->second.height == bh && it->second.format == format)
+            {
+                lease.width = width;
+                lease.height = height;
+                it->second.lastUsed = frame_;
+                ++hits_;
+                return true;
+            }
+        }
+        release(lease);
+
+        if (wantSlot)
+        {
+            if (!leaseSlot_(lease, renderer, bw, bh, format)) return false;
+            lease.width = width;
+            lease.height = height;
+            return true;
+        }
+
+        // Most recently released texture of the same bucket first
+        SDL_Texture* texture = nullptr;
+        for (std::size_t i = free_.size(); i-- > 0; )
+        {
+            const Entry& e = entries_[free_[i]];
+            if (e.width == bw && e.height == bh && e.format == format)
+            {
+                texture = free_[i];
+                free_.erase(free_.begin() + static_cast<std::ptrdiff_t>(i));
+                break;
+            }
+        }
+
+        if (texture)
+        {
+            pooledBytes_ -= entries_[texture].bytes;
+            ++hits_;
+        }
+        else
+        {
+            texture = SDL_CreateTexture(renderer, format, SDL_TEXTUREACCESS_TARGET, bw, bh);
+            if (!texture)
+            {
+                DEBUG_LOG(std::string("TexturePool::lease - SDL_CreateTexture failed: ") + SDL_GetError());
+                return false;
+            }
+            Entry e;
+            e.width = bw;
+            e.height = bh;
+            e.format = format;
+            e.bytes = static_cast<std::size_t>(bw) * bh * SDL_BYTESPERPIXEL(format);
+            entries_[texture] = e;
+            ++misses_;
+        }
+
+        // Reset whatever state the previous holder left behind
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+        SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+        SDL_SetTextureColorMod(texture, 255, 255, 255);
+        SDL_SetTextureAlphaMod(texture, 255);
+
+        Entry& entry = entries_[texture];
+        entry.id = nextId_++;
+        entry.lastUsed = frame_;
+        leasedBytes_ += entry.bytes;
+
+        lease.texture = texture;
+        lease.x = 0;
+        lease.y = 0;
+        lease.width = width;
+        lease.height = height;
+        lease.id = entry.id;
+        return true;
+    } // END: TexturePool::lease()
+
+    void TexturePool::release(Lease& lease)
+    {
+        if (lease.texture)
+        {
+            auto slot = slots_.find(lease.id);
+            if (slot != slots_.end())
+            {
+                freeCell_(*slot->second.page, slot->second.cell);
+                slots_.erase(slot);
+                lease = Lease{};
+                return;
+            }
+
+            auto it = entries_.find(lease.texture);
+            if (it != entries_.end() && it->second.id == lease.id)
+            {
+                it->second.id = 0;
+                it->second.lastUsed = frame_;
+                leasedBytes_ -= it->second.bytes;
+                pooledBytes_ += it->second.bytes;
+                free_.push_back(lease.texture);
+            }
+        }
+        lease = Lease{};
+    } // END: TexturePool::release()
+
+    bool TexturePool::sync(Lease& lease) const
+    {
+        if (!lease.texture) return true;
+
+        auto slot = slots_.find(lease.id);
+        if (slot != slots_.end())
+        {
+            lease.texture = slot->second.page->texture;
+            lease.x = slot->second.cell.x + ATLAS_PADDING;
+            lease.y = slot->second.cell.y + ATLAS_PADDING;
+            return true;
+        }
+
+        auto it = entries_.find(lease.texture);
+        if (it != entries_.end() && it->second.id == lease.id) return true;
+
+        // The texture went away with clear(); the holder has to repaint
+        lease = Lease{};
+        return false;
+    } // END: TexturePool::sync()
+
+    void TexturePool::trim()
+    {
+        ++frame_;
+
+        // free_ is ordered by release time, so the front is least recently used
+        std::size_t evict = 0;
+        std::size_t bytes = pooledBytes_;
+        while (evict < free_.size())
+        {
+            const Entry& e = entries_[free_[evict]];
+            const bool idle = frame_ - e.lastUsed > IDLE_FRAMES;
+            if (!idle && bytes <= budget_) break;
+            bytes -= e.bytes;
+            ++evict;
+        }
+        for (std::size_t i = 0; i < evict; ++i)
+        {
+            pooledBytes_ -= entries_[free_[i]].bytes;
+            destroy_(free_[i]);
+            ++evictions_;
+        }
+        free_.erase(free_.begin(), free_.begin() + static_cast<std::ptrdiff_t>(evict));
+
+        // Free atlas pages that have sat empty, and compact at most one page
+        // per frame whose live cells are few and scattered between holes
+        Page* sparse = nullptr;
+        float sparsest = ATLAS_SPARSE;
+        constexpr float pageArea = float(ATLAS_PAGE_SIZE) * float(ATLAS_PAGE_SIZE);
+        for (auto it = pages_.begin(); it != pages_.end(); )
+        {
+            Page& page = **it;
+            if (page.liveSlots == 0)
+            {
+                if (frame_ - page.lastUsed > IDLE_FRAMES)
+                {
+                    SDL_DestroyTexture(page.texture);
+                    it = pages_.erase(it);
+                    ++evictions_;
+                    continue;
+                }
+            }
+            else
+            {
+                const float live = float(page.liveArea) / pageArea;
+                if (live < sparsest && page.usedArea >= 2 * page.liveArea)
+                {
+                    sparsest = live;
+                    sparse = &page;
+                }
+            }
+            ++it;
+        }
+        if (sparse) compactPage_(*sparse);
+    } // END: TexturePool::trim()
+
+    void TexturePool::clear()
+    {
+        for (auto& [texture, entry] : entries_)
+        {
+            (void)entry;
+            if (renderer_) SDL_DestroyTexture(texture);
+        }
+        for (auto& page : pages_)
+        {
+            if (renderer_) SDL_DestroyTexture(page->texture);
+        }
+        entries_.clear();
+        free_.clear();
+        pages_.clear();
+        slots_.clear();
+        leasedBytes_ = 0;
+        pooledBytes_ = 0;
+        renderer_ = nullptr;
+    } // END: TexturePool::clear()
+
+    TexturePool::Stats TexturePool::getStats() const
+    {
+        Stats s;
+        s.textures = entries_.size();
+        s.leased = entries_.size() - free_.size();
+        s.leasedBytes = leasedBytes_;
+        s.pooledBytes = pooledBytes_;
+        s.hits = hits_;
+        s.misses = misses_;
+        s.evictions = evictions_;
+        s.atlasPages = pages_.size();
+        s.atlasSlots = slots_.size();
+        for (const auto& page : pages_)
+            s.atlasBytes += std::size_t(ATLAS_PAGE_SIZE) * ATLAS_PAGE_SIZE * SDL_BYTESPERPIXEL(page->format);
+        s.relocations = relocations_;
+        return s;
+    } // END: TexturePool::getStats()
+
+
+
+    // --- Atlas Pages --- //
+
+    bool TexturePool::leaseSlot_(Lease& lease, SDL_Renderer* renderer, int bw, int bh, SDL_PixelFormat format)
+    {
+        const std::size_t pageCount = pages_.size();
+        Page* page = nullptr;
+        SDL_Rect cell{};
+        if (!allocateCell_(renderer, bw + 2 * ATLAS_PADDING, bh + 2 * ATLAS_PADDING, format, nullptr, page, cell))
+            return false;
+        if (pages_.size() == pageCount) ++hits_; else ++misses_;
+
+        page->liveArea += static_cast<std::size_t>(cell.w) * cell.h;
+        ++page->liveSlots;
+        page->lastUsed = frame_;
+
+        const std::uint64_t id = nextId_++;
+        slots_[id] = Slot{ page, cell };
+
+        lease.texture = page->texture;
+        lease.x = cell.x + ATLAS_PADDING;
+        lease.y = cell.y + ATLAS_PADDING;
+        lease.id = id;
+        return true;
+    } // END: TexturePool::leaseSlot_()
+
+    bool TexturePool::allocateCell_(SDL_Renderer* renderer, int cw, int ch, SDL_PixelFormat format,
+                                    const Page* exclude, Page*& outPage, SDL_Rect& outCell)
+    {
+        // A freed cell of the same bucket first, newest pages first
+        for (auto it = pages_.rbegin(); it != pages_.rend(); ++it)
+        {
+            Page& page = **it;
+            if (&page == exclude || page.format != format) continue;
+            for (std::size_t i = page.freeCells.size(); i-- > 0; )
+            {
+                if (page.freeCells[i].w != cw || page.freeCells[i].h != ch) continue;
+                outCell = page.freeCells[i];
+                page.freeCells.erase(page.freeCells.begin() + static_cast<std::ptrdiff_t>(i));
+                outPage = &page;
+                return true;
+            }
+        }
+
+        // Then room on a shelf
+        for (auto it = pages_.rbegin(); it != pages_.rend(); ++it)
+        {
+            Page& page = **it;
+            if (&page == exclude || page.format != format) continue;
+            int x = page.shelfX, y = page.shelfY, h = page.shelfH;
+            if (x + cw > ATLAS_PAGE_SIZE)
+            {
+                // Close the current shelf and open a new one below it
+                y += h;
+                x = 0;
+                h = 0;
+            }
+            if (x + cw > ATLAS_PAGE_SIZE || y + ch > ATLAS_PAGE_SIZE) continue;
+            page.shelfX = x + cw;
+            page.shelfY = y;
+            page.shelfH = std::max(h, ch);
+            page.usedArea += static_cast<std::size_t>(cw) * ch;
+            outCell = SDL_Rect{ x, y, cw, ch };
+            outPage = &page;
+            return true;
+        }
+
+        // Then a fresh page
+        Page* page = addPage_(renderer, format);
+        if (!page) return false;
+        page->shelfX = cw;
+        page->shelfH = ch;
+        page->usedArea = static_cast<std::size_t>(cw) * ch;
+        outCell = SDL_Rect{ 0, 0, cw, ch };
+        outPage = page;
+        return true;
+    } // END: TexturePool::allocateCell_()
+
+    TexturePool::Page* TexturePool::addPage_(SDL_Renderer* renderer, SDL_PixelFormat format)
+    {
+        SDL_Texture* texture = SDL_CreateTexture(renderer, format, SDL_TEXTUREACCESS_TARGET, ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE);
+        if (!texture)
+        {
+            DEBUG_LOG(std::string("TexturePool::addPage_ - SDL_CreateTexture failed: ") + SDL_GetError());
+            return nullptr;
+        }
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+        SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+
+        // Clear the page so gutters never sample uninitialized texels
+        SDL_Texture* prev = SDL_GetRenderTarget(renderer);
+        SDL_SetRenderTarget(renderer, texture);
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+        SDL_RenderClear(renderer);
+        SDL_SetRenderTarget(renderer, prev);
+
+        auto page = std::make_unique<Page>();
+        page->texture = texture;
+        page->format = format;
+        page->lastUsed = frame_;
+        pages_.push_back(std::move(page));
+        return pages_.back().get();
+    } // END: TexturePool::addPage_()
+
+    void TexturePool::freeCell_(Page& page, const SDL_Rect& cell)
+    {
+        page.liveArea -= static_cast<std::size_t>(cell.w) * cell.h;
+        --page.liveSlots;
+        page.lastUsed = frame_;
+        if (page.liveSlots == 0)
+        {
+            // Nothing left on the page; start packing from the top again
+            page.shelfX = page.shelfY = page.shelfH = 0;
+            page.freeCells.clear();
+            page.usedArea = 0;
+            return;
+        }
+        page.freeCells.push_back(cell);
+    } // END: TexturePool::freeCell_()
+
+    void TexturePool::compactPage_(Page& page)
+    {
+        if (!renderer_) return;
+
+        // Copy texels (alpha included) rather than blending them
+        SDL_Texture* prev = SDL_GetRenderTarget(renderer_);
+        SDL_SetTextureBlendMode(page.texture, SDL_BLENDMODE_NONE);
+        SDL_SetTextureScaleMode(page.texture, SDL_SCALEMODE_NEAREST);
+        SDL_SetTextureColorMod(page.texture, 255, 255, 255);
+        SDL_SetTextureAlphaMod(page.texture, 255);
+
+        for (auto& [id, slot] : slots_)
+        {
+            (void)id;
+            if (slot.page != &page) continue;
+
+            Page* dest = nullptr;
+            SDL_Rect cell{};
+            if (!allocateCell_(renderer_, slot.cell.w, slot.cell.h, page.format, &page, dest, cell))
+                break;
+
+            SDL_SetRenderTarget(renderer_, dest->texture);
+            const SDL_FRect src{ float(slot.cell.x), float(slot.cell.y), float(slot.cell.w), float(slot.cell.h) };
+            const SDL_FRect dst{ float(cell.x), float(cell.y), float(cell.w), float(cell.h) };
+            SDL_RenderTexture(renderer_, page.texture, &src, &dst);
+
+            dest->liveArea += static_cast<std::size_t>(cell.w) * cell.h;
+            ++dest->liveSlots;
+            dest->lastUsed = frame_;
+            freeCell_(page, slot.cell);
+            slot = Slot{ dest, cell };
+            ++relocations_;
+        }
+
+        SDL_SetTextureBlendMode(page.texture, SDL_BLENDMODE_BLEND);
+        SDL_SetRenderTarget(renderer_, prev);
+        if (page.liveSlots == 0) destroyPage_(&page);
+    } // END: TexturePool::compactPage_()
+
+    void TexturePool::destroyPage_(Page* page)
+    {
+        auto it = std::find_if(pages_.begin(), pages_.end(),
+                               [page](const std::unique_ptr<Page>& p) { return p.get() == page; });
+        if (it == pages_.end()) return;
+        SDL_DestroyTexture(page->texture);
+        pages_.erase(it);
+    } // END: TexturePool::destroyPage_()
+
+
+    // --- Target --- //
+
+    TexturePool::Target::Target(SDL_Renderer* renderer, const Lease& lease)
+        : renderer_(renderer)
+    {
+        if (!renderer_ || !lease.texture) return;
+        prevTarget_ = SDL_GetRenderTarget(renderer_);
+        if (!SDL_SetRenderTarget(renderer_, lease.texture)) return;
+        bound_ = true;
+
+        // Local 0,0 maps to the lease's corner; the clip rect is viewport-relative
+        const SDL_Rect area{ lease.x, lease.y, lease.width, lease.height };
+        const SDL_Rect local{ 0, 0, lease.width, lease.height };
+        SDL_SetRenderViewport(renderer_, &area);
+        SDL_SetRenderClipRect(renderer_, &local);
+
+        // SDL_RenderClear ignores the viewport and would wipe the whole page
+        const SDL_FRect rect{ 0.0f, 0.0f, float(lease.width), float(lease.height) };
+        SDL_SetRenderDrawBlendMode(renderer_, SDL_BLENDMODE_NONE);
+        SDL_SetRenderDrawColor(renderer_, 0, 0, 0, 0);
+        SDL_RenderFillRect(renderer_, &rect);
+        SDL_SetRenderDrawBlendMode(renderer_, SDL_BLENDMODE_BLEND);
+    } // END: TexturePool::Target::Target()
+
+    TexturePool::Target::~Target()
+    {
+        if (!bound_) return;
+        // Batched quads pick up the viewport when submitted, so submit them now
+        getCore().getSpriteBatch().flush();
+        SDL_SetRenderClipRect(renderer_, nullptr);
+        SDL_SetRenderViewport(renderer_, nullptr);
+        SDL_SetRenderTarget(renderer_, prevTarget_);
+    } // END: TexturePool::Target::~Target()
+
+
+    void TexturePool::destroy_(SDL_Texture* texture)
+    {
+        SDL_DestroyTexture(texture);
+        entries_.erase(texture);
+    } // END: TexturePool::destroy_()
+
+} // END: namespace SDOM
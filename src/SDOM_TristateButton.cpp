@@ -267,14 +267,12 @@ namespace SDOM
         SDL_Color borderColor = fontStyle.borderColor;
         if (fontStyle.border) 
         {
-            SDL_SetRenderDrawBlendMode(getRenderer(), SDL_BLENDMODE_BLEND);
-            SDL_SetRenderDrawColor(getRenderer(), borderColor.r, borderColor.g, borderColor.b, borderColor.a);
             SDL_FRect rect = { 
                 static_cast<float>(getX()), 
                 static_cast<float>(getY()), 
                 static_cast<float>(getWidth()), 
                 static_cast<float>(getHeight()) };
-            SDL_RenderRect(getRenderer(), &rect);
+            getCore().getRenderCommands().outlineRect(rect, borderColor);
         }
 
     } // END: void TristateButton::onRender()
@@ -164,201 +164,109 @@ namespace SDOM
 
     void TruetypeFont::drawGlyph(Uint32 ch, int x, int y, const FontStyle& style) 
     {
-        if (!ttf_font_handle_.isValid())   
-        {
-            DEBUG_LOG("TruetypeFont::drawGlyph - invalid TTF asset handle");
-            return;
-        }
+        TTF_Font* ttf_font_ = _getValidTTFFontPtr();
+        if (!ttf_font_) return;
+        if (!TTF_FontHasGlyph(ttf_font_, ch)) return;
+
         TTFAsset* ttfAsset = ttf_font_handle_->as<TTFAsset>();
-        if (!ttfAsset || !ttfAsset->isLoaded()) 
-        {
-            DEBUG_LOG("TruetypeFont::drawGlyph - TTF asset not loaded: " + filename_);
-            return;
-        }
-        TTF_Font* ttf_font_ = ttfAsset->_getTTFFontPtr();
-        if (!ttf_font_) 
-        {
-            DEBUG_LOG("TruetypeFont::drawGlyph - TTF font pointer is null: " + filename_);
-            return;
-        }
+        SDL_Renderer* renderer = getRenderer();
+        if (!renderer) return;
+        GlyphAtlas& atlas = ttfAsset->getGlyphAtlas();
+        SpriteBatch::Scope batchScope(getCore().getSpriteBatch());
 
-        // Lambda for rendering a glyph with a given color and outline
+        // Lambda for drawing the cached glyph with a given color and outline
         auto render_glyph = [&](SDL_Color drawColor, float px, float py, int outline) 
         {
-            TTF_SetFontOutline(ttf_font_, outline);
-            SDL_Surface* glyphSurface = TTF_RenderGlyph_Blended(ttf_font_, ch, drawColor);
-            if (glyphSurface)
-            {
-                SDL_Renderer* renderer = getRenderer();
-                if (renderer)
-                {
-                    SDL_Texture* glyphTexture = SDL_CreateTextureFromSurface(renderer, glyphSurface);
-                    if (glyphTexture)
-                    {
-                        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-                        SDL_SetRenderDrawColor(renderer, drawColor.r, drawColor.g, drawColor.b, drawColor.a);
-                        SDL_FRect destRect = { (float)px, (float)py, (float)glyphSurface->w, (float)glyphSurface->h };
-                        if (!SDL_RenderTexture(renderer, glyphTexture, nullptr, &destRect))
-                        {
-                            ERROR(std::string("Failed to render glyph texture: ") + SDL_GetError());
-                        }
-                        SDL_DestroyTexture(glyphTexture);
-                    }
-                }
-                SDL_DestroySurface(glyphSurface);
-            }
+            GlyphAtlas::Variant variant{ static_cast<float>(TTF_GetFontSize(ttf_font_)), styleMaskFor_(style), outline };
+            const GlyphAtlas::Glyph* glyph = atlas.getGlyph(renderer, ttf_font_, ch, variant);
+            if (glyph) atlas.drawGlyph(renderer, *glyph, px, py, drawColor);
         };
 
-        // Render glyph using TTF font
-        if (ttf_font_)
+        // Drop shadow pass (if enabled)
+        if (style.dropshadow) 
         {
-            if (TTF_FontHasGlyph(ttf_font_, ch))
-            {
-                // Render glyph using TTF font
-                if (!ttf_font_) return;
-                if (!TTF_FontHasGlyph(ttf_font_, ch)) return;
-
-                // Build style bitmask
-                int styleMask = TTF_STYLE_NORMAL;
-                if (style.bold) styleMask |= TTF_STYLE_BOLD;
-                if (style.italic) styleMask |= TTF_STYLE_ITALIC;
-                if (style.underline) styleMask |= TTF_STYLE_UNDERLINE;
-                if (style.strikethrough) styleMask |= TTF_STYLE_STRIKETHROUGH;
-                TTF_SetFontStyle(ttf_font_, styleMask);
-
-                // Drop shadow pass (if enabled)
-                if (style.dropshadow) 
-                {
-                    render_glyph(style.dropshadowColor, x+style.dropshadowOffsetX, y+style.dropshadowOffsetY, style.outlineThickness);
-                    render_glyph(style.dropshadowColor, x+style.dropshadowOffsetX, y+style.dropshadowOffsetY, 0);
-                }
-
-                // Outline pass (if enabled)
-                if (style.outline) {
-                    render_glyph(style.outlineColor, x-style.outlineThickness, y-style.outlineThickness, style.outlineThickness);
-                }
+            render_glyph(style.dropshadowColor, x+style.dropshadowOffsetX, y+style.dropshadowOffsetY, style.outlineThickness);
+            render_glyph(style.dropshadowColor, x+style.dropshadowOffsetX, y+style.dropshadowOffsetY, 0);
+        }
 
-                // Foreground pass (always)
-                render_glyph(style.foregroundColor, x, y, 0);
-            }
+        // Outline pass (if enabled)
+        if (style.outline) {
+            render_glyph(style.outlineColor, x-style.outlineThickness, y-style.outlineThickness, style.outlineThickness);
         }
+
+        // Foreground pass (always)
+        render_glyph(style.foregroundColor, x, y, 0);
     } // END: TruetypeFont::drawGlyph(Uint32 ch, int x, int y, const FontStyle& style) 
 
     void TruetypeFont::drawPhrase(const std::string& str, int x, int y, const FontStyle& style) 
     {
-        TTF_Font* ttf_font_ = _getValidTTFFontPtr();
-        if (!ttf_font_ || str.empty()) return;
-        // Set font style
-        int styleMask = TTF_STYLE_NORMAL;
-        if (style.bold) styleMask |= TTF_STYLE_BOLD;
-        if (style.italic) styleMask |= TTF_STYLE_ITALIC;
-        if (style.underline) styleMask |= TTF_STYLE_UNDERLINE;
-        if (style.strikethrough) styleMask |= TTF_STYLE_STRIKETHROUGH;
-        TTF_SetFontStyle(ttf_font_, styleMask);
-        // Lambda for rendering a phrase with a given color and outline
-        auto render_phrase = [&](SDL_Color drawColor, int px, int py, int outline) 
-        {
-            TTF_SetFontOutline(ttf_font_, outline);
-            SDL_Surface* textSurface = TTF_RenderText_Blended(ttf_font_, str.c_str(), str.length(), drawColor);
-            if (textSurface) 
-            {
-                SDL_Renderer* renderer = getRenderer();
-                if (renderer) 
-                {
-                    SDL_Texture* textTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
-                    if (textTexture) 
-                    {
-                        SDL_FRect destRect = { (float)px, (float)py, (float)textSurface->w, (float)textSurface->h };
-                        // SDL_SetTextureAlphaMod(textTexture, drawColor.a);
-                        SDL_RenderTexture(renderer, textTexture, nullptr, &destRect);
-                        SDL_DestroyTexture(textTexture);
-                    }
-                }
-                SDL_DestroySurface(textSurface);
-            }
-        };
+        if (str.empty()) return;
         // Foreground pass (always)
-        render_phrase(style.foregroundColor, x, y, 0);
+        drawGlyphRun_(str, x, y, style.foregroundColor, 0, styleMaskFor_(style));
     } // END: TruetypeFont::drawPhrase(const std::string& str, int x, int y, const FontStyle& style) 
 
     void TruetypeFont::drawPhraseOutline(const std::string& str, int x, int y, const FontStyle& style) 
     {
-        TTF_Font* ttf_font_ = _getValidTTFFontPtr();
-        if (!ttf_font_ || str.empty()) return;
+        if (str.empty()) return;
         if (!style.outline && style.outlineThickness < 1) return;
-
-        // Set font style
-        int styleMask = TTF_STYLE_NORMAL;
-        if (style.bold) styleMask |= TTF_STYLE_BOLD;
-        if (style.italic) styleMask |= TTF_STYLE_ITALIC;
-        if (style.underline) styleMask |= TTF_STYLE_UNDERLINE;
-        if (style.strikethrough) styleMask |= TTF_STYLE_STRIKETHROUGH;
-        TTF_SetFontStyle(ttf_font_, styleMask);
-        // Lambda for rendering a phrase with a given color and outline
-        auto render_phrase = [&](SDL_Color drawColor, int px, int py, int outline) 
-        {
-            TTF_SetFontOutline(ttf_font_, outline);
-            SDL_Surface* textSurface = TTF_RenderText_Blended(ttf_font_, str.c_str(), str.length(), drawColor);
-            if (textSurface) 
-            {
-                SDL_Renderer* renderer = getRenderer();
-                if (renderer) 
-                {
-                    SDL_Texture* textTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
-                    if (textTexture) 
-                    {
-                        SDL_FRect destRect = { (float)px, (float)py, (float)textSurface->w, (float)textSurface->h };
-                        SDL_RenderTexture(renderer, textTexture, nullptr, &destRect);
-                        SDL_DestroyTexture(textTexture);
-                    }
-                }
-                SDL_DestroySurface(textSurface);
-            }
-        };
         // Outline pass
-        render_phrase(style.outlineColor, x - style.outlineThickness, y - style.outlineThickness, style.outlineThickness);
+        drawGlyphRun_(str, x - style.outlineThickness, y - style.outlineThickness, style.outlineColor, style.outlineThickness, styleMaskFor_(style));
     } // END: TruetypeFont::drawPhraseOutline(const std::string& str, int x, int y, const FontStyle& style) 
 
     void TruetypeFont::drawPhraseDropshadow(const std::string& str, int x, int y, const FontStyle& style) 
     {
-        TTF_Font* ttf_font_ = _getValidTTFFontPtr();
-        if (!ttf_font_ || str.empty()) return;
-
+        if (str.empty()) return;
         if (!style.dropshadow)
             return;
+        // Drop shadow pass
+        const int styleMask = styleMaskFor_(style);
+        drawGlyphRun_(str, x + style.dropshadowOffsetX, y + style.dropshadowOffsetY, style.dropshadowColor, style.outlineThickness, styleMask);
+        drawGlyphRun_(str, x + style.dropshadowOffsetX, y + style.dropshadowOffsetY, style.dropshadowColor, 0, styleMask);
+    } // END: TruetypeFont::drawPhraseDropshadow(const std::string& str, int x, int y, const FontStyle& style) 
 
-        // Set font style
+    void TruetypeFont::drawGlyphRun_(const std::string& str, int x, int y, SDL_Color color, int outline, int styleMask)
+    {
+        TTF_Font* ttf_font_ = _getValidTTFFontPtr();
+        if (!ttf_font_ || str.empty()) return;
+        SDL_Renderer* renderer = getRenderer();
+        if (!renderer) return;
+        GlyphAtlas& atlas = ttf_font_handle_->as<TTFAsset>()->getGlyphAtlas();
+        const GlyphAtlas::Variant variant{ static_cast<float>(TTF_GetFontSize(ttf_font_)), styleMask, outline };
+        SpriteBatch::Scope batchScope(getCore().getSpriteBatch());
+
+        // Walk the UTF-8 string, applying kerning between consecutive glyphs
+        const char* cursor = str.c_str();
+        size_t remaining = str.length();
+        float penX = static_cast<float>(x);
+        Uint32 prev = 0;
+        while (remaining > 0)
+        {
+            Uint32 ch = SDL_StepUTF8(&cursor, &remaining);
+            if (ch == 0) break;
+            if (prev)
+            {
+                int kerning = 0;
+                if (TTF_GetGlyphKerning(ttf_font_, prev, ch, &kerning)) penX += static_cast<float>(kerning);
+            }
+            const GlyphAtlas::Glyph* glyph = atlas.getGlyph(renderer, ttf_font_, ch, variant);
+            if (glyph)
+            {
+                atlas.drawGlyph(renderer, *glyph, penX, static_cast<float>(y), color);
+                penX += static_cast<float>(glyph->advance);
+            }
+            prev = ch;
+        }
+    } // END: TruetypeFont::drawGlyphRun_()
+
+    int TruetypeFont::styleMaskFor_(const FontStyle& style)
+    {
         int styleMask = TTF_STYLE_NORMAL;
         if (style.bold) styleMask |= TTF_STYLE_BOLD;
         if (style.italic) styleMask |= TTF_STYLE_ITALIC;
         if (style.underline) styleMask |= TTF_STYLE_UNDERLINE;
         if (style.strikethrough) styleMask |= TTF_STYLE_STRIKETHROUGH;
-        TTF_SetFontStyle(ttf_font_, styleMask);
-        // Lambda for rendering a phrase with a given color and outline
-        auto render_phrase = [&](SDL_Color drawColor, int px, int py, int outline) 
-        {
-            TTF_SetFontOutline(ttf_font_, outline);
-            SDL_Surface* textSurface = TTF_RenderText_Blended(ttf_font_, str.c_str(), str.length(), drawColor);
-            if (textSurface) 
-            {
-                SDL_Renderer* renderer = getRenderer();
-                if (renderer) 
-                {
-                    SDL_Texture* textTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
-                    if (textTexture) 
-                    {
-                        SDL_FRect destRect = { (float)px, (float)py, (float)textSurface->w, (float)textSurface->h };
-                        SDL_RenderTexture(renderer, textTexture, nullptr, &destRect);
-                        SDL_DestroyTexture(textTexture);
-                    }
-                }
-                SDL_DestroySurface(textSurface);
-            }
-        };
-        // Drop shadow pass
-        render_phrase(style.dropshadowColor, x + style.dropshadowOffsetX, y + style.dropshadowOffsetY, style.outlineThickness);
-        render_phrase(style.dropshadowColor, x + style.dropshadowOffsetX, y + style.dropshadowOffsetY, 0);
-    } // END: TruetypeFont::drawPhraseDropshadow(const std::string& str, int x, int y, const FontStyle& style) 
+        return styleMask;
+    } // END: TruetypeFont::styleMaskFor_()
 
     bool TruetypeFont::getGlyphMetrics(Uint32 ch, int *minx, int *maxx, int *miny, int *maxy, int *advance) const 
     {